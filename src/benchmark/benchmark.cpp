@@ -1,13 +1,19 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <format>
+#include <latch>
 #include <numeric>
+#include <random>
+#include <thread>
 
 #include <spdlog/spdlog.h>
 
 #include "benchmark/blas_functions.h"
+#include "utils/scaling.h"
+#include "utils/statistics.h"
 #include "utils/timer.h"
 
 namespace blas_benchmark
@@ -20,6 +26,100 @@ namespace
 extern "C" void openblas_set_num_threads(int num_threads);
 extern "C" int openblas_get_num_threads();
 
+// Results of one kernel and config at every thread count of a sweep, in run order;
+// a weak scaling series is identified by its config at the smallest count
+std::vector<BenchmarkResult*> same_benchmark(std::vector<BenchmarkResult>& results, const BenchmarkResult& r)
+{
+    std::vector<BenchmarkResult*> group;
+    for (auto& other : results)
+    {
+        if (other.function_name == r.function_name && other.weak == r.weak &&
+            (r.weak ? other.base_config == r.base_config : other.config_str == r.config_str))
+        {
+            group.push_back(&other);
+        }
+    }
+    return group;
+}
+
+// Fill speedup, parallel efficiency and knee from the median times of each thread sweep;
+// weak series are compared on time per unit of the smallest count's work
+void annotate_scaling(std::vector<BenchmarkResult>& results)
+{
+    for (auto& r : results)
+    {
+        if (r.knee_threads != 0)
+        {
+            continue; // Already annotated as part of an earlier group
+        }
+        auto group = same_benchmark(results, r);
+        const auto* base = *std::min_element(group.begin(), group.end(), [](const auto* a, const auto* b) {
+            return a->threads < b->threads;
+        });
+        std::vector<std::pair<int, double>> times;
+        for (auto* member : group)
+        {
+            if (member->weak && base->flops > 0)
+            {
+                member->work_scale = static_cast<double>(member->flops) / static_cast<double>(base->flops);
+            }
+            times.emplace_back(member->threads, member->median_time_ms / member->work_scale);
+        }
+
+        auto curve = utils::scaling_curve(times);
+        const int knee = curve[utils::knee_index(curve)].threads;
+        for (auto* member : group)
+        {
+            auto point = std::find_if(curve.begin(), curve.end(), [member](const utils::ScalingPoint& p) {
+                return p.threads == member->threads;
+            });
+            member->speedup = point->speedup;
+            member->parallel_efficiency = point->efficiency;
+            member->knee_threads = knee;
+        }
+    }
+}
+
+// Pair every SMT siblings result with its one-thread-per-core run and fill both gains
+void annotate_smt(std::vector<BenchmarkResult>& results)
+{
+    for (auto& r : results)
+    {
+        // A single thread has no sibling to share its core with
+        if (r.smt != "siblings" || r.threads < 2)
+        {
+            continue;
+        }
+        const auto cores_config = r.config_str.substr(0, r.config_str.size() - std::string("siblings").size()) + "cores";
+        auto cores = std::find_if(results.begin(), results.end(), [&r, &cores_config](const BenchmarkResult& other) {
+            return other.smt == "cores" && other.function_name == r.function_name && other.threads == r.threads &&
+                   other.config_str == cores_config;
+        });
+        if (cores != results.end() && cores->gflops > 0.0)
+        {
+            r.smt_gain = r.gflops / cores->gflops - 1.0;
+            cores->smt_gain = r.smt_gain;
+        }
+    }
+}
+
+// Size part of a Level 2/3 report config, with only the dimensions the kernel reads
+// (all of them for names the registry does not know); K exists at Level 3 only
+std::string size_config(const KernelDescriptor* kernel, BlasLevel level, const ProblemSize& size)
+{
+    std::string config;
+    if (kernel == nullptr || kernel->uses_m)
+    {
+        config = std::format("M={},", size.m);
+    }
+    config += std::format("N={}", size.n);
+    if (level == BlasLevel::level3 && (kernel == nullptr || kernel->uses_k))
+    {
+        config += std::format(",K={}", size.k);
+    }
+    return config;
+}
+
 } // anonymous namespace
 
 BenchmarkRunner::BenchmarkRunner(const config::BenchmarkConfig& config)
@@ -36,6 +136,82 @@ BenchmarkRunner::BenchmarkRunner(const config::BenchmarkConfig& config)
     }
     
     spdlog::info("Cache size for flushing: {} MB", m_cache_size / (1024 * 1024));
+
+    auto flush_mode = utils::parse_flush_mode(m_config.flush_cache);
+
+    // Warm/cold reporting needs a cold primary series; fall back to targeted eviction
+    if (m_config.warm_cold &&
+        (flush_mode == utils::FlushMode::none || flush_mode == utils::FlushMode::warm))
+    {
+        spdlog::info("Warm/cold mode: using clflush for the cold series");
+        flush_mode = utils::FlushMode::clflush;
+    }
+    // The report names the mode actually used
+    m_config.flush_cache = utils::to_string(flush_mode);
+
+    if (flush_mode != utils::FlushMode::none)
+    {
+        utils::CacheFlusherOptions options;
+        options.mode = flush_mode;
+        options.huge_pages = m_config.flush_huge_pages;
+        options.numa = utils::parse_numa_placement(m_config.flush_numa);
+        m_flusher = std::make_unique<utils::CacheFlusher>(m_cache_size, options);
+    }
+
+    if (m_config.warm_cold)
+    {
+        utils::CacheFlusherOptions options;
+        options.mode = utils::FlushMode::warm;
+        m_warm_flusher = std::make_unique<utils::CacheFlusher>(m_cache_size, options);
+    }
+
+    // Use the configured seed, or draw one so the run can still be reproduced
+    if (m_config.seed.has_value())
+    {
+        m_seed = m_config.seed.value();
+    }
+    else
+    {
+        std::random_device rd;
+        m_seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+    }
+
+    spdlog::info("Operand seed: {}", m_seed);
+
+    m_pin = utils::parse_pin_spec(m_config.pin);
+    if (m_config.smt_compare)
+    {
+        m_smt_compare = utils::has_smt_siblings(utils::read_cpu_topology());
+        if (!m_smt_compare)
+        {
+            spdlog::warn("SMT comparison: no core has an online SMT sibling; running without it");
+            m_config.smt_compare = false;
+        }
+        else if (m_pin.policy != utils::PinPolicy::none)
+        {
+            spdlog::warn("SMT comparison pins every run itself; pin = {} is ignored", m_config.pin);
+        }
+    }
+
+    m_timer_source = utils::parse_timer_source(m_config.timer);
+    m_timer_overhead_ns = m_timer_source == utils::TimerSource::tsc ? utils::measure_timer_overhead_ns<utils::CycleTimer>()
+                                                                    : utils::measure_timer_overhead_ns<utils::Timer>();
+    if (utils::CycleTimer::supported())
+    {
+        spdlog::info("Invariant TSC: {:.3f} GHz", utils::CycleTimer::tsc_hz() / 1e9);
+    }
+    spdlog::info("Timer: {}, overhead: {:.1f} ns", utils::to_string(m_timer_source), m_timer_overhead_ns);
+
+    if (m_config.perf_counters)
+    {
+        utils::PerfCounters probe;
+        m_perf_counters = probe.available();
+        if (!m_perf_counters)
+        {
+            spdlog::warn("Hardware counters unavailable ({}); check /proc/sys/kernel/perf_event_paranoid",
+                         probe.error());
+        }
+    }
 }
 
 void BenchmarkRunner::set_threads(int num_threads)
@@ -49,14 +225,92 @@ BenchmarkReport BenchmarkRunner::run_all()
     BenchmarkReport report;
     report.system_info = m_info_collector.collect();
     report.config = m_config;
+    report.seed = m_seed;
+    report.timer_overhead_ns = m_timer_overhead_ns;
+    report.timer = utils::to_string(m_timer_source);
+    report.tsc_ghz = utils::CycleTimer::supported() ? utils::CycleTimer::tsc_hz() / 1e9 : 0.0;
 
     spdlog::info("Starting benchmark on {}", report.system_info.cpu_model);
     spdlog::info("CPU cores: {} physical, {} logical", 
                  report.system_info.physical_cores, report.system_info.cpu_cores);
 
-    // Set thread count
-    set_threads(m_config.threads);
+    report.thread_counts = resolve_thread_counts(report.system_info);
+    const int smallest = *std::min_element(report.thread_counts.begin(), report.thread_counts.end());
 
+    // Weak scaling needs several thread counts; without a sweep only the fixed sizes run
+    const auto scaling = utils::parse_scaling_mode(m_config.scaling);
+    const bool sweeping = report.thread_counts.size() > 1;
+    const bool strong = scaling != utils::ScalingMode::weak || !sweeping;
+    const bool weak = scaling != utils::ScalingMode::strong && sweeping;
+    if (m_smt_compare && *std::max_element(report.thread_counts.begin(), report.thread_counts.end()) < 2)
+    {
+        spdlog::warn("SMT comparison needs at least 2 threads; both placements run on one CPU");
+    }
+    if (scaling != utils::ScalingMode::strong && !sweeping)
+    {
+        spdlog::warn("Weak scaling needs a thread sweep; running the fixed sizes only");
+    }
+
+    auto run = [this, &report]() {
+        if (m_smt_compare)
+        {
+            run_smt_comparison(report);
+        }
+        else
+        {
+            run_levels(report);
+        }
+    };
+
+    for (int threads : report.thread_counts)
+    {
+        // Set thread count
+        m_config.threads = threads;
+        set_threads(threads);
+        apply_pinning(threads);
+        if (m_config.instances > 1 && threads > 1)
+        {
+            spdlog::warn("Throughput mode with {} threads per instance: OpenBLAS has one shared thread pool, "
+                         "so concurrent multi-threaded calls may queue on it", threads);
+        }
+
+        // Machine roofs at the benchmark thread count, measured before any kernel runs
+        if (m_config.roofline)
+        {
+            m_peaks = utils::measure_machine_peaks(report.system_info, threads, m_pinned_cpus);
+            report.peaks.push_back(*m_peaks);
+        }
+
+        if (strong)
+        {
+            run();
+        }
+        if (weak)
+        {
+            m_weak_factor = static_cast<double>(threads) / smallest;
+            spdlog::info("Weak scaling: sizes grown for {:.2f}x the work of {} thread(s)", m_weak_factor, smallest);
+            run();
+            m_weak_factor = 0.0;
+        }
+    }
+
+    if (report.thread_counts.size() > 1)
+    {
+        annotate_scaling(report.level1_results);
+        annotate_scaling(report.level2_results);
+        annotate_scaling(report.level3_results);
+    }
+    if (m_smt_compare)
+    {
+        annotate_smt(report.level1_results);
+        annotate_smt(report.level2_results);
+        annotate_smt(report.level3_results);
+    }
+    return report;
+}
+
+void BenchmarkRunner::run_levels(BenchmarkReport& report)
+{
     // Run benchmarks for each level
     if (m_config.level1_size.has_value() && !m_config.level1_functions.empty())
     {
@@ -75,159 +329,693 @@ BenchmarkReport BenchmarkRunner::run_all()
         spdlog::info("Running Level 3 benchmarks...");
         run_level3(report);
     }
+}
 
-    return report;
+void BenchmarkRunner::run_smt_comparison(BenchmarkReport& report)
+{
+    // Both passes also run at one thread (on the same CPU), so each placement has
+    // a series of its own in a thread sweep; the cores series ends at the physical core count
+    const int threads = m_config.threads;
+    const auto configured = m_pin;
+    const std::array passes{std::pair{"cores", utils::PinPolicy::physical_only},
+                            std::pair{"siblings", utils::PinPolicy::compact}};
+    const auto topology = utils::read_cpu_topology();
+    for (const auto& [smt, policy] : passes)
+    {
+        // Past the physical core count the cores pass would double up on siblings as well,
+        // so only the siblings placement runs and there is nothing to compare against
+        if (policy == utils::PinPolicy::physical_only &&
+            static_cast<int>(utils::select_cpus(utils::PinSpec{policy, {}}, threads, topology).size()) < threads)
+        {
+            spdlog::warn("SMT comparison: {} threads exceed the physical cores; skipping the cores run", threads);
+            continue;
+        }
+        spdlog::info("SMT comparison: {} thread(s) on {}", threads, smt);
+        m_pin = utils::PinSpec{policy, {}};
+        apply_pinning(threads);
+
+        std::array results{&report.level1_results, &report.level2_results, &report.level3_results};
+        std::array<std::size_t, 3> first{};
+        for (std::size_t level = 0; level < results.size(); ++level)
+        {
+            first[level] = results[level]->size();
+        }
+        run_levels(report);
+        for (std::size_t level = 0; level < results.size(); ++level)
+        {
+            for (std::size_t i = first[level]; i < results[level]->size(); ++i)
+            {
+                auto& r = (*results[level])[i];
+                r.smt = smt;
+                r.config_str += std::format(",smt={}", smt);
+                if (r.weak)
+                {
+                    r.base_config += std::format(",smt={}", smt);
+                }
+            }
+        }
+    }
+
+    // Hand the threads back all online CPUs unless the configured policy pins them anyway
+    m_pin = configured;
+    if (m_pin.policy == utils::PinPolicy::none)
+    {
+        std::vector<int> all;
+        for (const auto& location : utils::read_cpu_topology())
+        {
+            all.push_back(location.cpu);
+        }
+        (void)utils::set_thread_affinity(all);
+        (void)utils::set_process_affinity(all);
+    }
+    apply_pinning(threads);
+}
+
+void BenchmarkRunner::mark_weak(std::vector<BenchmarkResult>& results, std::size_t first,
+                                const std::string& config_str, const std::string& base_config) const
+{
+    if (m_weak_factor <= 0.0)
+    {
+        return;
+    }
+    for (std::size_t i = first; i < results.size(); ++i)
+    {
+        auto& r = results[i];
+        // Mode and layout suffixes do not depend on the size
+        r.weak = true;
+        r.base_config = base_config + r.config_str.substr(config_str.size());
+        r.config_str += ",scaling=weak";
+    }
+}
+
+void BenchmarkRunner::apply_pinning(int threads)
+{
+    m_pinned_cpus = utils::select_cpus(m_pin, threads, utils::read_cpu_topology());
+    if (m_pin.policy == utils::PinPolicy::list && m_pinned_cpus.size() < m_pin.cpus.size())
+    {
+        std::vector<int> dropped;
+        for (int cpu : m_pin.cpus)
+        {
+            if (std::find(m_pinned_cpus.begin(), m_pinned_cpus.end(), cpu) == m_pinned_cpus.end())
+            {
+                dropped.push_back(cpu);
+            }
+        }
+        spdlog::warn("Pinning list CPUs {} are not online; skipped", utils::format_cpu_list(dropped));
+    }
+    if (m_pinned_cpus.empty())
+    {
+        m_placement = "none";
+        return;
+    }
+    if (static_cast<int>(m_pinned_cpus.size()) < threads)
+    {
+        spdlog::warn("Pinning {} threads to {} CPU(s): threads will share CPUs", threads, m_pinned_cpus.size());
+    }
+
+    // The main thread and each OpenBLAS worker get a CPU of their own, in placement
+    // order: the main thread is OpenBLAS's thread 0 and takes the first CPU
+    auto cpus = utils::format_cpu_list(m_pinned_cpus);
+    if (int failed = utils::pin_process_threads(m_pinned_cpus); failed > 0)
+    {
+        spdlog::warn("Cannot pin {} thread(s) to CPUs {}", failed, cpus);
+    }
+    m_placement = std::format("{} {}", utils::to_string(m_pin.policy), cpus);
+    spdlog::info("Pinned {} thread(s): {}", threads, m_placement);
+}
+
+void BenchmarkRunner::verify_placement(BenchmarkResult& result) const
+{
+    // The first `threads` threads in tid order are the main thread and the OpenBLAS
+    // workers in use; with enough CPUs each must be pinned to a CPU of its own
+    const auto active = static_cast<std::size_t>(std::max(m_config.threads, 1));
+    const bool exclusive = m_pinned_cpus.size() >= active;
+    std::vector<int> used;
+    std::vector<int> claimed;
+    const auto placement = utils::read_thread_placement();
+    for (std::size_t i = 0; i < placement.size(); ++i)
+    {
+        const auto& thread = placement[i];
+        if (thread.last_cpu >= 0)
+        {
+            used.push_back(thread.last_cpu);
+        }
+        if (m_pinned_cpus.empty())
+        {
+            continue;
+        }
+        bool inside = std::all_of(thread.allowed.begin(), thread.allowed.end(), [this](int cpu) {
+            return std::find(m_pinned_cpus.begin(), m_pinned_cpus.end(), cpu) != m_pinned_cpus.end();
+        });
+        if (!inside)
+        {
+            spdlog::warn("  {} - thread {} may run on CPUs {}, outside the pinned set {}", result.function_name,
+                         thread.tid, utils::format_cpu_list(thread.allowed), utils::format_cpu_list(m_pinned_cpus));
+        }
+        if (!exclusive || i >= active)
+        {
+            continue;
+        }
+        if (thread.allowed.size() != 1 ||
+            std::find(claimed.begin(), claimed.end(), thread.allowed.front()) != claimed.end())
+        {
+            spdlog::warn("  {} - worker thread {} may run on CPUs {}, not a CPU of its own", result.function_name,
+                         thread.tid, utils::format_cpu_list(thread.allowed));
+            continue;
+        }
+        claimed.push_back(thread.allowed.front());
+    }
+    result.placement = m_placement;
+    result.cpus_used = utils::format_cpu_list(used);
+}
+
+std::vector<int> BenchmarkRunner::resolve_thread_counts(const utils::SystemInfo& info) const
+{
+    if (m_config.thread_sweep.empty())
+    {
+        return {m_config.threads};
+    }
+
+    const int logical = std::max(info.cpu_cores, 1);
+    const int physical = info.physical_cores > 0 ? info.physical_cores : logical;
+    std::vector<int> counts;
+    for (const auto& entry : m_config.thread_sweep)
+    {
+        int count = entry == "physical" ? physical : (entry == "logical" ? logical : std::stoi(entry));
+        if (std::find(counts.begin(), counts.end(), count) == counts.end())
+        {
+            counts.push_back(count);
+        }
+    }
+    return counts;
 }
 
-template<typename Func>
 BenchmarkResult BenchmarkRunner::run_single_benchmark(
-    const std::string& name,
-    const std::string& config_str,
-    Func&& benchmark_func,
-    std::size_t flops_count)
+    const KernelDescriptor& kernel,
+    const ProblemSize& size,
+    const std::string& config_str)
 {
+    const auto& name = kernel.short_name;
+    const auto flops_count = kernel.flops(size);
+    const auto traffic = kernel.bytes(size);
+
     BenchmarkResult result;
     result.function_name = name;
+    result.operation = kernel.operation;
+    result.precision_char = kernel.precision;
+    result.real_bits = kernel.real_bits;
     result.config_str = config_str;
     result.threads = m_config.threads;
     result.flops = flops_count;
+    result.bytes_read = traffic.read;
+    result.bytes_written = traffic.written;
 
     spdlog::info("Running {} benchmark...", name);
 
-    // Collect timing data
-    std::vector<double> times;
-    times.reserve(m_config.cycles);
+    for (auto* flusher : {m_flusher.get(), m_warm_flusher.get()})
+    {
+        if (flusher != nullptr)
+        {
+            flusher->reset_stats();
+        }
+    }
 
-    for (int i = 0; i < m_config.cycles; ++i)
+    auto fixture = kernel.make_fixture(size, m_seed);
+
+    // Warmup once per fixture; timed cycles reuse the warmed operands
+    fixture.warmup(static_cast<std::size_t>(m_config.warmup), m_flusher.get());
+
+    // Collect timing data, batching short kernels so each sample beats timer resolution
+    result.repetitions = calibrate_repetitions(fixture, m_flusher.get());
+    // Counters are opened after warmup so every OpenBLAS worker thread already exists
+    std::unique_ptr<utils::PerfCounters> counters;
+    if (m_perf_counters)
     {
-        double time_ms = benchmark_func();
-        times.push_back(time_ms);
-        spdlog::debug("  Iteration {}: {:.3f} ms", i + 1, time_ms);
+        counters = std::make_unique<utils::PerfCounters>();
+        counters->reset();
+    }
+
+    auto times = time_cycles(fixture, m_flusher.get(), result.repetitions, counters.get());
+    if (counters && counters->available())
+    {
+        result.perf = counters->read().scaled(static_cast<double>(times.size() * result.repetitions));
     }
 
     // Calculate statistics
-    result.min_time_ms = *std::min_element(times.begin(), times.end());
-    result.max_time_ms = *std::max_element(times.begin(), times.end());
-    result.avg_time_ms = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    auto stats = utils::compute_stats(times);
+    result.min_time_ms = stats.min;
+    result.max_time_ms = stats.max;
+    result.avg_time_ms = stats.mean;
+    result.median_time_ms = stats.median;
+    result.stddev_time_ms = stats.stddev;
+    result.mad_time_ms = stats.mad;
+    result.p5_time_ms = stats.p5;
+    result.p95_time_ms = stats.p95;
+    result.p99_time_ms = stats.p99;
+    result.cv = stats.cv;
+    result.measured_time_ms = std::accumulate(times.begin(), times.end(), 0.0) * result.repetitions;
+    result.setup_time_ms = fixture.setup_time_ms();
+    result.warmup_time_ms = fixture.warmup_time_ms();
+    result.operand_checksum = fixture.operand_checksum();
 
     // Calculate GFLOPS
     // GFLOPS = FLOPs / (time_seconds * 1e9)
     double time_sec = result.avg_time_ms / 1000.0;
     result.gflops = static_cast<double>(flops_count) / (time_sec * 1e9);
 
-    spdlog::info("  {} - Avg: {:.3f} ms, Min: {:.3f} ms, Max: {:.3f} ms, GFLOPS: {:.2f}",
-                 name, result.avg_time_ms, result.min_time_ms, result.max_time_ms, result.gflops);
+    // Effective bandwidth: modelled traffic over the same mean time
+    result.gbs = static_cast<double>(traffic.total()) / (time_sec * 1e9);
+
+    // GFLOPS confidence interval: bootstrap the mean time, then invert
+    auto time_ci = utils::bootstrap_ci(times, utils::mean, 0.95, 1000, m_seed);
+    result.gflops_ci_lower = time_ci.upper > 0.0 ? static_cast<double>(flops_count) / (time_ci.upper / 1000.0 * 1e9) : 0.0;
+    result.gflops_ci_upper = time_ci.lower > 0.0 ? static_cast<double>(flops_count) / (time_ci.lower / 1000.0 * 1e9) : 0.0;
+    result.precision = median_precision(times, 1000);
+
+    // Reference cycles per call from the calibrated TSC rate
+    if (utils::CycleTimer::supported())
+    {
+        result.cycles_per_call = result.median_time_ms * 1e-3 * utils::CycleTimer::tsc_hz();
+        result.flops_per_cycle = result.cycles_per_call > 0.0 ? static_cast<double>(flops_count) / result.cycles_per_call : 0.0;
+    }
+    result.samples_ms = std::move(times);
+
+    spdlog::info("  {} - Avg: {:.6f} ms, Min: {:.6f} ms, Max: {:.6f} ms, GFLOPS: {:.2f}, GB/s: {:.2f}",
+                 name, result.avg_time_ms, result.min_time_ms, result.max_time_ms, result.gflops, result.gbs);
+    spdlog::info("  {} - Median: {:.6f} ms, StdDev: {:.6f} ms, CV: {:.2f}%, GFLOPS 95% CI: [{:.2f}, {:.2f}]",
+                 name, result.median_time_ms, result.stddev_time_ms, result.cv * 100.0,
+                 result.gflops_ci_lower, result.gflops_ci_upper);
+    spdlog::info("  {} - Samples: {} x {} calls, Precision: +/-{:.2f}% (median, 95% CI)",
+                 name, result.samples_ms.size(), result.repetitions, result.precision * 100.0);
+    if (result.cycles_per_call > 0.0)
+    {
+        spdlog::info("  {} - Ref cycles/call: {:.0f}, FLOPs/cycle: {:.2f}",
+                     name, result.cycles_per_call, result.flops_per_cycle);
+    }
+    if (m_peaks && traffic.total() > 0)
+    {
+        std::size_t working_set = 0;
+        for (const auto& region : fixture.operands())
+        {
+            working_set += region.bytes;
+        }
+        const bool cold = m_flusher && m_flusher->options().mode != utils::FlushMode::warm;
+
+        result.arithmetic_intensity = static_cast<double>(flops_count) / static_cast<double>(traffic.total());
+        auto bound = utils::roofline_bound(*m_peaks, result.arithmetic_intensity, working_set, cold,
+                                           kernel.real_bits == 32);
+        result.roofline_gflops = bound.gflops;
+        result.roofline_limit = bound.limit;
+        result.roofline_pct = bound.gflops > 0.0 ? result.gflops / bound.gflops * 100.0 : 0.0;
+
+        spdlog::info("  {} - AI: {:.3f} FLOPs/byte, bound: {:.2f} GFLOPS ({}), achieved {:.1f}% of roofline",
+                     name, result.arithmetic_intensity, result.roofline_gflops, result.roofline_limit,
+                     result.roofline_pct);
+    }
+    if (result.perf)
+    {
+        spdlog::info("  {} - IPC: {:.2f}, LLC miss: {:.2f}%, dTLB miss: {:.3f}%, FP width: {:.0f} bits",
+                     name, result.perf->ipc(), result.perf->llc_miss_rate() * 100.0,
+                     result.perf->dtlb_miss_rate() * 100.0, result.perf->vector_width_bits(kernel.real_bits));
+    }
+
+    // Same fixture again with hot caches; the series above is the cold one
+    if (m_warm_flusher)
+    {
+        auto warm_repetitions = calibrate_repetitions(fixture, m_warm_flusher.get());
+        auto warm_times = time_cycles(fixture, m_warm_flusher.get(), warm_repetitions);
+        double warm_total_ms = std::accumulate(warm_times.begin(), warm_times.end(), 0.0);
+        result.measured_time_ms += warm_total_ms * warm_repetitions;
+
+        result.cold_time_ms = result.avg_time_ms;
+        result.cold_gflops = result.gflops;
+        result.warm_time_ms = warm_total_ms / warm_times.size();
+        result.warm_gflops = static_cast<double>(flops_count) / (result.warm_time_ms / 1000.0 * 1e9);
+
+        spdlog::info("  {} - Warm: {:.6f} ms ({:.2f} GFLOPS), Cold: {:.6f} ms ({:.2f} GFLOPS), Cold/Warm: {:.2f}",
+                     name, result.warm_time_ms, result.warm_gflops,
+                     result.cold_time_ms, result.cold_gflops, result.cold_warm_ratio());
+    }
+
+    for (auto* flusher : {m_flusher.get(), m_warm_flusher.get()})
+    {
+        if (flusher != nullptr)
+        {
+            result.flush_time_ms += flusher->total_flush_ms();
+        }
+    }
+
+    spdlog::info("  {} - Setup: {:.3f} ms, Warmup: {:.3f} ms, Measured: {:.3f} ms, Flush: {:.3f} ms",
+                 name, result.setup_time_ms, result.warmup_time_ms, result.measured_time_ms,
+                 result.flush_time_ms);
+
+    if (m_config.instances > 1)
+    {
+        // Concurrent copies run without flushing: calibrate the batch for warm calls
+        run_throughput(kernel, size, calibrate_repetitions(fixture, nullptr), result);
+    }
+
+    verify_placement(result);
+    spdlog::info("  {} - Placement: {}, threads last ran on CPUs {}", name, result.placement, result.cpus_used);
 
     return result;
 }
 
-void BenchmarkRunner::run_level1(BenchmarkReport& report)
+void BenchmarkRunner::run_throughput(const KernelDescriptor& kernel, const ProblemSize& size,
+                                     std::size_t repetitions, BenchmarkResult& result)
+{
+    const auto& name = kernel.short_name;
+    const int instances = m_config.instances;
+    const auto samples = std::max<std::size_t>(result.samples_ms.size(), 2);
+    const double flops_per_instance = static_cast<double>(result.flops) * static_cast<double>(samples * repetitions);
+
+    spdlog::info("  {} - Throughput: {} instance(s) x {} samples x {} calls", name, instances, samples, repetitions);
+
+    // The isolated baseline goes through the same thread, fixture and warmup path
+    double isolated_wall_ms = 0.0;
+    auto isolated = run_instances(kernel, size, 1, samples, repetitions, isolated_wall_ms);
+    double concurrent_wall_ms = 0.0;
+    auto concurrent = run_instances(kernel, size, instances, samples, repetitions, concurrent_wall_ms);
+
+    std::vector<double> pooled;
+    double fastest = 0.0;
+    double slowest = 0.0;
+    for (const auto& times : concurrent)
+    {
+        pooled.insert(pooled.end(), times.begin(), times.end());
+        double med = utils::median(times);
+        fastest = fastest == 0.0 ? med : std::min(fastest, med);
+        slowest = std::max(slowest, med);
+    }
+    auto stats = utils::compute_stats(pooled);
+
+    result.instances = instances;
+    result.isolated_median_ms = utils::median(isolated.front());
+    result.instance_median_ms = stats.median;
+    result.instance_p95_ms = stats.p95;
+    result.instance_p99_ms = stats.p99;
+    result.instance_spread = fastest > 0.0 ? slowest / fastest : 0.0;
+    result.isolated_gflops = isolated_wall_ms > 0.0 ? flops_per_instance / (isolated_wall_ms * 1e6) : 0.0;
+    result.throughput_gflops = concurrent_wall_ms > 0.0 ? flops_per_instance * instances / (concurrent_wall_ms * 1e6) : 0.0;
+    result.interference_slowdown = result.isolated_median_ms > 0.0 ? result.instance_median_ms / result.isolated_median_ms : 0.0;
+    result.measured_time_ms += isolated_wall_ms + concurrent_wall_ms;
+
+    spdlog::info("  {} - Isolated: {:.6f} ms ({:.2f} GFLOPS), {} instances: median {:.6f} ms, P95 {:.6f} ms, P99 {:.6f} ms",
+                 name, result.isolated_median_ms, result.isolated_gflops, instances, result.instance_median_ms,
+                 result.instance_p95_ms, result.instance_p99_ms);
+    spdlog::info("  {} - Aggregate: {:.2f} GFLOPS ({:.2f}x isolated), slowdown {:.2f}x, instance spread {:.2f}x",
+                 name, result.throughput_gflops,
+                 result.isolated_gflops > 0.0 ? result.throughput_gflops / result.isolated_gflops : 0.0,
+                 result.interference_slowdown, result.instance_spread);
+}
+
+std::vector<std::vector<double>> BenchmarkRunner::run_instances(const KernelDescriptor& kernel, const ProblemSize& size,
+                                                                int instances, std::size_t samples,
+                                                                std::size_t repetitions, double& wall_ms) const
 {
-    auto n = m_config.level1_size.value();
-    auto config_str = std::format("N={}", n);
+    // Each instance gets `threads` CPUs of one selection covering all instances
+    const int threads = std::max(m_config.threads, 1);
+    const auto cpus = utils::select_cpus(m_pin, instances * threads, utils::read_cpu_topology());
 
-    for (const auto& func_name : m_config.level1_functions)
+    std::vector<std::vector<double>> times(instances);
+    std::latch ready(instances);
+    std::latch start(1);
+    std::vector<std::thread> workers;
+    workers.reserve(instances);
+    for (int i = 0; i < instances; ++i)
     {
-        BenchmarkResult result;
+        workers.emplace_back([&, i]() {
+            if (!cpus.empty())
+            {
+                std::vector<int> own;
+                for (int t = 0; t < threads; ++t)
+                {
+                    own.push_back(cpus[static_cast<std::size_t>(i * threads + t) % cpus.size()]);
+                }
+                (void)utils::set_thread_affinity(own);
+            }
+
+            // Operands are first touched on the instance's own thread; seeds differ per instance
+            auto fixture = kernel.make_fixture(size, m_seed + static_cast<std::uint64_t>(i));
+            fixture.warmup(static_cast<std::size_t>(m_config.warmup), nullptr);
 
-        if (func_name == "cblas_ddot")
+            ready.count_down();
+            start.wait();
+            times[i].reserve(samples);
+            for (std::size_t s = 0; s < samples; ++s)
+            {
+                times[i].push_back(fixture.run(nullptr, repetitions, m_timer_overhead_ns, m_timer_source));
+            }
+        });
+    }
+
+    ready.wait();
+    utils::Timer timer;
+    timer.start();
+    start.count_down();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    timer.stop();
+    wall_ms = timer.elapsed_ms();
+    return times;
+}
+
+std::size_t BenchmarkRunner::calibrate_repetitions(BenchmarkFixture& fixture, utils::CacheFlusher* flusher) const
+{
+    // Batching would leave only the first call of a sample cold
+    if (flusher != nullptr && flusher->options().mode != utils::FlushMode::warm)
+    {
+        return 1;
+    }
+    if (m_config.min_sample_time_ms <= 0.0)
+    {
+        return 1;
+    }
+
+    constexpr std::size_t max_repetitions = std::size_t{1} << 24;
+    std::size_t repetitions = 1;
+
+    while (repetitions < max_repetitions)
+    {
+        double sample_ms = fixture.run(flusher, repetitions, m_timer_overhead_ns, m_timer_source) * repetitions;
+        if (sample_ms >= m_config.min_sample_time_ms)
         {
-            result = run_single_benchmark(
-                "ddot", config_str,
-                [this, n]() {
-                    return benchmark_dot<double>(n, m_config.warmup, 1, 
-                                                  m_config.flush_cache, m_cache_size);
-                },
-                flops::dot(n));
+            break;
         }
-        else if (func_name == "cblas_daxpy")
+
+        // Jump close to the target, but at least double, with some headroom for noise
+        double scale = sample_ms > 0.0 ? m_config.min_sample_time_ms / sample_ms * 1.2 : 16.0;
+        auto next = static_cast<std::size_t>(std::ceil(repetitions * std::clamp(scale, 2.0, 1024.0)));
+        repetitions = std::min(next, max_repetitions);
+    }
+
+    spdlog::debug("  Calibrated {} calls per sample", repetitions);
+    return repetitions;
+}
+
+std::vector<double> BenchmarkRunner::time_cycles(BenchmarkFixture& fixture, utils::CacheFlusher* flusher,
+                                                 std::size_t repetitions, utils::PerfCounters* counters)
+{
+    std::vector<double> times;
+
+    if (!m_config.adaptive)
+    {
+        times.reserve(m_config.cycles);
+        for (int i = 0; i < m_config.cycles; ++i)
         {
-            result = run_single_benchmark(
-                "daxpy", config_str,
-                [this, n]() {
-                    return benchmark_axpy<double>(n, m_config.warmup, 1,
-                                                   m_config.flush_cache, m_cache_size);
-                },
-                flops::axpy(n));
+            double time_ms = fixture.run(flusher, repetitions, m_timer_overhead_ns, m_timer_source, counters);
+            times.push_back(time_ms);
+            spdlog::debug("  Iteration {}: {:.3f} ms", i + 1, time_ms);
         }
-        else if (func_name == "cblas_dscal")
+        return times;
+    }
+
+    const auto min_cycles = static_cast<std::size_t>(std::max(2, m_config.min_cycles));
+    const auto max_cycles = static_cast<std::size_t>(std::max(m_config.min_cycles, m_config.max_cycles));
+    const double budget_ms = m_config.time_budget_sec * 1000.0;
+
+    utils::Timer budget_timer;
+    budget_timer.start();
+
+    // Bootstrap is far more expensive than a short kernel, so convergence is
+    // checked at geometrically spaced sample counts rather than after every call
+    std::size_t next_check = min_cycles;
+    double precision = 0.0;
+
+    while (times.size() < max_cycles)
+    {
+        double time_ms = fixture.run(flusher, repetitions, m_timer_overhead_ns, m_timer_source, counters);
+        times.push_back(time_ms);
+        spdlog::debug("  Iteration {}: {:.3f} ms", times.size(), time_ms);
+
+        budget_timer.stop();
+        if (budget_timer.elapsed_ms() >= budget_ms && times.size() >= min_cycles)
         {
-            result = run_single_benchmark(
-                "dscal", config_str,
-                [this, n]() {
-                    return benchmark_scal<double>(n, m_config.warmup, 1,
-                                                   m_config.flush_cache, m_cache_size);
-                },
-                flops::scal(n));
+            spdlog::debug("  Time budget of {:.1f} s exhausted", m_config.time_budget_sec);
+            break;
         }
-        else
+
+        if (times.size() >= next_check)
         {
-            spdlog::warn("Unknown Level 1 function: {}", func_name);
-            continue;
+            precision = median_precision(times, 200);
+            if (precision <= m_config.target_precision)
+            {
+                break;
+            }
+            next_check = std::max(times.size() + 1, times.size() * 11 / 10);
         }
+    }
+
+    spdlog::debug("  Adaptive sampling stopped after {} samples", times.size());
+    return times;
+}
 
-        report.level1_results.push_back(result);
+double BenchmarkRunner::median_precision(const std::vector<double>& times, std::size_t resamples) const
+{
+    double med = utils::median(times);
+    if (med <= 0.0)
+    {
+        return 0.0;
     }
+    auto ci = utils::bootstrap_ci(times, utils::median, 0.95, resamples, m_seed);
+    return (ci.upper - ci.lower) / 2.0 / med;
 }
 
-void BenchmarkRunner::run_level2(BenchmarkReport& report)
+void BenchmarkRunner::run_level1(BenchmarkReport& report)
 {
-    auto [m, n] = m_config.level2_size.value();
-    auto config_str = std::format("M={},N={}", m, n);
+    const auto n = m_config.level1_size.value();
+    ProblemSize size;
+    size.n = m_weak_factor > 0.0 ? utils::weak_dimension(n, 1, m_weak_factor) : n;
+    size.large_magnitude = m_config.large_magnitude;
+    auto config_str = std::format("N={}", size.n);
 
-    for (const auto& func_name : m_config.level2_functions)
-    {
-        BenchmarkResult result;
+    const auto first = report.level1_results.size();
+    run_kernels(BlasLevel::level1, m_config.level1_functions, size, config_str, report.level1_results);
+    mark_weak(report.level1_results, first, config_str, std::format("N={}", n));
+}
 
-        if (func_name == "cblas_dgemv")
-        {
-            result = run_single_benchmark(
-                "dgemv", config_str,
-                [this, m, n]() {
-                    return benchmark_gemv<double>(m, n, m_config.warmup, 1,
-                                                   m_config.flush_cache, m_cache_size);
-                },
-                flops::gemv(m, n));
-        }
-        else
-        {
-            spdlog::warn("Unknown Level 2 function: {}", func_name);
-            continue;
-        }
+void BenchmarkRunner::set_modes(ProblemSize& size) const
+{
+    size.side = parse_side(m_config.side);
+    size.uplo = parse_uplo(m_config.uplo);
+    size.trans = parse_transpose(m_config.trans);
+    size.diag = parse_diag(m_config.diag);
+}
 
-        report.level2_results.push_back(result);
+void BenchmarkRunner::run_level2(BenchmarkReport& report)
+{
+    auto [m, n] = m_config.level2_size.value();
+    ProblemSize size{static_cast<std::size_t>(m), static_cast<std::size_t>(n), 0};
+    if (m_weak_factor > 0.0)
+    {
+        size.m = utils::weak_dimension(size.m, 2, m_weak_factor);
+        size.n = utils::weak_dimension(size.n, 2, m_weak_factor);
     }
+    size.kl = static_cast<std::size_t>(m_config.band_kl);
+    size.ku = static_cast<std::size_t>(m_config.band_ku);
+    set_modes(size);
+
+    const ProblemSize base{static_cast<std::size_t>(m), static_cast<std::size_t>(n), 0};
+    run_matrix_kernels(BlasLevel::level2, m_config.level2_functions, size, base, report.level2_results);
 }
 
 void BenchmarkRunner::run_level3(BenchmarkReport& report)
 {
     auto [m, n, k] = m_config.level3_size.value();
-    auto config_str = std::format("M={},N={},K={}", m, n, k);
+    ProblemSize size{static_cast<std::size_t>(m), static_cast<std::size_t>(n), static_cast<std::size_t>(k)};
+    if (m_weak_factor > 0.0)
+    {
+        // M*N*K grows with the thread count, so gemm-like work per thread stays constant
+        size.m = utils::weak_dimension(size.m, 3, m_weak_factor);
+        size.n = utils::weak_dimension(size.n, 3, m_weak_factor);
+        size.k = utils::weak_dimension(size.k, 3, m_weak_factor);
+    }
+    set_modes(size);
 
-    for (const auto& func_name : m_config.level3_functions)
+    const ProblemSize base{static_cast<std::size_t>(m), static_cast<std::size_t>(n), static_cast<std::size_t>(k)};
+    run_matrix_kernels(BlasLevel::level3, m_config.level3_functions, size, base, report.level3_results);
+}
+
+void BenchmarkRunner::run_matrix_kernels(BlasLevel level, const std::vector<std::string>& functions,
+                                         const ProblemSize& size, const ProblemSize& base,
+                                         std::vector<BenchmarkResult>& results)
+{
+    for (const auto& func_name : functions)
     {
-        BenchmarkResult result;
+        const auto* kernel = KernelRegistry::instance().find(func_name);
+        auto config_str = size_config(kernel, level, size);
 
-        if (func_name == "cblas_dgemm")
+        const auto first = results.size();
+        run_kernels(level, {func_name}, size, config_str, results);
+        mark_weak(results, first, config_str, size_config(kernel, level, base));
+    }
+}
+
+void BenchmarkRunner::run_kernels(BlasLevel level, const std::vector<std::string>& functions,
+                                  const ProblemSize& size, const std::string& config_str,
+                                  std::vector<BenchmarkResult>& results)
+{
+    for (const auto& func_name : functions)
+    {
+        // Names are validated at config-parse time; this only guards hand-built configs
+        const auto* kernel = KernelRegistry::instance().find(func_name);
+        if (kernel == nullptr || kernel->level != level)
         {
-            result = run_single_benchmark(
-                "dgemm", config_str,
-                [this, m, n, k]() {
-                    return benchmark_gemm<double>(m, n, k, m_config.warmup, 1,
-                                                   m_config.flush_cache, m_cache_size);
-                },
-                flops::gemm(m, n, k));
+            spdlog::warn("Unknown Level {} function: {}", static_cast<int>(level), func_name);
+            continue;
         }
-        else
+
+        auto kernel_config = kernel->modes ? config_str + "," + kernel->modes(size) : config_str;
+        if (!kernel->layout)
         {
-            spdlog::warn("Unknown Level 3 function: {}", func_name);
+            results.push_back(run_single_benchmark(*kernel, size, kernel_config));
             continue;
         }
 
-        report.level3_results.push_back(result);
+        // Combinations the kernel does not use (trans_b of gemv) collapse to one tag
+        std::vector<std::string> seen;
+        for (const auto& variant : layout_variants(size))
+        {
+            auto layout = kernel->layout(variant);
+            if (std::find(seen.begin(), seen.end(), layout) != seen.end())
+            {
+                continue;
+            }
+            seen.push_back(layout);
+
+            auto result = run_single_benchmark(*kernel, variant, kernel_config + ",layout=" + layout);
+            result.layout = layout;
+            results.push_back(std::move(result));
+        }
     }
 }
 
+std::vector<ProblemSize> BenchmarkRunner::layout_variants(const ProblemSize& size) const
+{
+    std::vector<ProblemSize> variants;
+    for (const auto& order : m_config.layout_orders)
+    {
+        for (const auto& trans_a : m_config.layout_trans_a)
+        {
+            for (const auto& trans_b : m_config.layout_trans_b)
+            {
+                for (int padding : m_config.ld_paddings)
+                {
+                    ProblemSize variant = size;
+                    variant.order = parse_order(order);
+                    variant.trans_a = parse_transpose(trans_a);
+                    variant.trans_b = parse_transpose(trans_b);
+                    variant.ld_padding = static_cast<std::size_t>(padding);
+                    variants.push_back(variant);
+                }
+            }
+        }
+    }
+    return variants;
+}
+
 std::string OutputFormatter::to_markdown(const BenchmarkReport& report)
 {
     std::string output;
@@ -244,10 +1032,34 @@ std::string OutputFormatter::to_markdown(const BenchmarkReport& report)
                           report.system_info.l3_cache / (1024 * 1024));
     output += std::format("- **Memory**: {:.1f} GB\n",
                           static_cast<double>(report.system_info.total_memory) / (1024 * 1024 * 1024));
-    output += std::format("- **Threads**: {}\n\n", report.config.threads);
+    if (report.thread_counts.size() > 1)
+    {
+        std::string counts;
+        for (int count : report.thread_counts)
+        {
+            counts += std::format("{}{}", counts.empty() ? "" : ", ", count);
+        }
+        output += std::format("- **Threads**: sweep {} (scaling: {})\n", counts, report.config.scaling);
+    }
+    else
+    {
+        output += std::format("- **Threads**: {}\n", report.config.threads);
+    }
+    output += std::format("- **Pinning**: {}\n",
+                          report.config.smt_compare ? "physical-only vs SMT siblings" : report.config.pin);
+    if (report.config.instances > 1)
+    {
+        output += std::format("- **Instances**: {} concurrent\n", report.config.instances);
+    }
+    output += std::format("- **Cache Flush**: {}\n", report.config.flush_cache);
+    output += std::format("- **Seed**: {}\n", report.seed);
+    output += std::format("- **Timer**: {} ({:.1f} ns overhead", report.timer, report.timer_overhead_ns);
+    output += report.tsc_ghz > 0.0 ? std::format(", invariant TSC {:.3f} GHz)\n\n", report.tsc_ghz) : ")\n\n";
+
+    const bool warm_cold = report.config.warm_cold;
 
     // Helper lambda to format a table
-    auto format_table = [&output](const std::string& title, const std::vector<BenchmarkResult>& results)
+    auto format_table = [&output, warm_cold](const std::string& title, const std::vector<BenchmarkResult>& results)
     {
         if (results.empty())
         {
@@ -255,14 +1067,30 @@ std::string OutputFormatter::to_markdown(const BenchmarkReport& report)
         }
 
         output += std::format("### {}\n\n", title);
-        output += "| Function | Config | Threads | Min(ms) | Avg(ms) | Max(ms) | GFLOPS |\n";
-        output += "|:---------|:-------|:--------|:--------|:--------|:--------|:-------|\n";
+        output += "| Function | Config | Threads | Min(ms) | Avg(ms) | Max(ms) | GFLOPS | GB/s |";
+        if (warm_cold)
+        {
+            output += " Warm(ms) | Cold(ms) | Warm GFLOPS | Cold GFLOPS | Cold/Warm |";
+        }
+        output += "\n|:---------|:-------|:--------|:--------|:--------|:--------|:-------|:-----|";
+        if (warm_cold)
+        {
+            output += ":---------|:---------|:------------|:------------|:----------|";
+        }
+        output += "\n";
 
         for (const auto& r : results)
         {
-            output += std::format("| {} | {} | {} | {:.3f} | {:.3f} | {:.3f} | {:.2f} |\n",
+            output += std::format("| {} | {} | {} | {:.6f} | {:.6f} | {:.6f} | {:.2f} | {:.2f} |",
                                   r.function_name, r.config_str, r.threads,
-                                  r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops);
+                                  r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops, r.gbs);
+            if (warm_cold)
+            {
+                output += std::format(" {:.6f} | {:.6f} | {:.2f} | {:.2f} | {:.2f} |",
+                                      r.warm_time_ms, r.cold_time_ms, r.warm_gflops, r.cold_gflops,
+                                      r.cold_warm_ratio());
+            }
+            output += "\n";
         }
         output += "\n";
     };
@@ -271,6 +1099,334 @@ std::string OutputFormatter::to_markdown(const BenchmarkReport& report)
     format_table("Level 2 (Matrix-Vector)", report.level2_results);
     format_table("Level 3 (Matrix-Matrix)", report.level3_results);
 
+    // Single vs double precision (s/d, c/z) for every operation and size run in both
+    std::string comparison;
+    for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+    {
+        for (const auto& s : *results)
+        {
+            if (s.precision_char != 's' && s.precision_char != 'c')
+            {
+                continue;
+            }
+            const char wide = s.precision_char == 's' ? 'd' : 'z';
+            auto d = std::find_if(results->begin(), results->end(), [&s, wide](const BenchmarkResult& r) {
+                return r.precision_char == wide && r.operation == s.operation && r.config_str == s.config_str &&
+                       r.threads == s.threads;
+            });
+            if (d == results->end())
+            {
+                continue;
+            }
+            comparison += std::format("| {} | {}/{} | {} | {:.2f} | {:.2f} | {:.2f} | {:.2f} | {:.2f}x |\n",
+                                      s.operation, s.precision_char, wide, s.config_str, s.gflops, d->gflops,
+                                      s.gbs, d->gbs, d->gflops > 0.0 ? s.gflops / d->gflops : 0.0);
+        }
+    }
+    if (!comparison.empty())
+    {
+        output += "### Precision Comparison\n\n";
+        output += "| Operation | Pair | Config | Single GFLOPS | Double GFLOPS | Single GB/s | Double GB/s | Speedup |\n";
+        output += "|:----------|:-----|:-------|:--------------|:--------------|:------------|:------------|:--------|\n";
+        output += comparison + "\n";
+    }
+
+    // Layout sweep: every gemv/gemm layout against the fastest one at the same size,
+    // so layout-dependent cliffs stand out as low percentages
+    // The config without its layout tag identifies the size, modes and run variant
+    auto without_layout = [](const BenchmarkResult& r) {
+        auto config = r.config_str;
+        return config.erase(config.find(",layout=" + r.layout), (",layout=" + r.layout).size());
+    };
+    std::string sweep;
+    for (const auto* results : {&report.level2_results, &report.level3_results})
+    {
+        for (const auto& r : *results)
+        {
+            if (r.layout.empty())
+            {
+                continue;
+            }
+            const auto base = without_layout(r);
+            double best = 0.0;
+            std::size_t layouts = 0;
+            for (const auto& other : *results)
+            {
+                if (other.function_name == r.function_name && other.threads == r.threads &&
+                    !other.layout.empty() && without_layout(other) == base)
+                {
+                    best = std::max(best, other.gflops);
+                    ++layouts;
+                }
+            }
+            if (layouts < 2)
+            {
+                continue;
+            }
+            sweep += std::format("| {} | {} | {} | {:.2f} | {:.2f} | {:.1f} |\n",
+                                 r.function_name, base, r.layout, r.gflops, r.gbs,
+                                 best > 0.0 ? 100.0 * r.gflops / best : 0.0);
+        }
+    }
+    if (!sweep.empty())
+    {
+        output += "### Layout Sweep\n\n";
+        output += "Layout: order (R/C) / op(A)[op(B)] / leading-dimension padding in elements\n\n";
+        output += "| Function | Config | Layout | GFLOPS | GB/s | % of Best |\n";
+        output += "|:---------|:-------|:-------|:-------|:-----|:----------|\n";
+        output += sweep + "\n";
+    }
+
+    // Thread sweep: every kernel and config at each count against the smallest one
+    const bool sweeping = report.thread_counts.size() > 1;
+    if (sweeping && report.config.scaling != "weak")
+    {
+        output += "### Thread Scaling\n\n";
+        output += "| Function | Config | Threads | Median(ms) | GFLOPS | Speedup | Efficiency(%) | Knee |\n";
+        output += "|:---------|:-------|:--------|:-----------|:-------|:--------|:--------------|:-----|\n";
+        for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+        {
+            std::vector<const BenchmarkResult*> done;
+            for (const auto& r : *results)
+            {
+                if (r.weak || std::find(done.begin(), done.end(), &r) != done.end())
+                {
+                    continue;
+                }
+                std::vector<const BenchmarkResult*> group;
+                for (const auto& other : *results)
+                {
+                    if (!other.weak && other.function_name == r.function_name && other.config_str == r.config_str)
+                    {
+                        group.push_back(&other);
+                    }
+                }
+                std::sort(group.begin(), group.end(), [](const BenchmarkResult* a, const BenchmarkResult* b) {
+                    return a->threads < b->threads;
+                });
+                for (const auto* g : group)
+                {
+                    output += std::format("| {} | {} | {} | {:.6f} | {:.2f} | {:.2f}x | {:.1f} | {} |\n",
+                                          g->function_name, g->config_str, g->threads, g->median_time_ms,
+                                          g->gflops, g->speedup, g->parallel_efficiency * 100.0,
+                                          g->threads == g->knee_threads ? "knee" : "");
+                    done.push_back(g);
+                }
+            }
+        }
+        output += "\n";
+    }
+
+    // Throughput mode: concurrent instances against one instance alone; Scaling is
+    // aggregate over isolated GFLOPS, ideally equal to the instance count
+    if (report.config.instances > 1)
+    {
+        output += "### Throughput\n\n";
+        output += "| Function | Config | Threads | Instances | Isolated(ms) | Median(ms) | P95(ms) | P99(ms) | Spread | Slowdown | Isolated GFLOPS | Aggregate GFLOPS | Scaling |\n";
+        output += "|:---------|:-------|:--------|:----------|:-------------|:-----------|:--------|:--------|:-------|:---------|:----------------|:-----------------|:--------|\n";
+        for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+        {
+            for (const auto& r : *results)
+            {
+                output += std::format("| {} | {} | {} | {} | {:.6f} | {:.6f} | {:.6f} | {:.6f} | {:.2f}x | {:.2f}x | {:.2f} | {:.2f} | {:.2f}x |\n",
+                                      r.function_name, r.config_str, r.threads, r.instances,
+                                      r.isolated_median_ms, r.instance_median_ms, r.instance_p95_ms,
+                                      r.instance_p99_ms, r.instance_spread, r.interference_slowdown,
+                                      r.isolated_gflops, r.throughput_gflops,
+                                      r.isolated_gflops > 0.0 ? r.throughput_gflops / r.isolated_gflops : 0.0);
+            }
+        }
+        output += "\n";
+    }
+
+    // Strong vs weak scaling: both series of a kernel against the ideal, the thread ratio
+    // to the smallest count; a weak speedup is the scaled speedup (base work per unit time)
+    if (sweeping && report.config.scaling != "strong")
+    {
+        const int smallest = *std::min_element(report.thread_counts.begin(), report.thread_counts.end());
+        output += "### Strong vs Weak Scaling\n\n";
+        output += "| Function | Base Config | Threads | Ideal | Strong Speedup | Strong Eff(%) | Weak Config | Work | Weak Speedup | Weak Eff(%) |\n";
+        output += "|:---------|:------------|:--------|:------|:---------------|:--------------|:------------|:-----|:-------------|:------------|\n";
+        for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+        {
+            std::vector<const BenchmarkResult*> done;
+            for (const auto& r : *results)
+            {
+                if (!r.weak || std::find(done.begin(), done.end(), &r) != done.end())
+                {
+                    continue;
+                }
+                std::vector<const BenchmarkResult*> group;
+                for (const auto& other : *results)
+                {
+                    if (other.weak && other.function_name == r.function_name && other.base_config == r.base_config)
+                    {
+                        group.push_back(&other);
+                    }
+                }
+                std::sort(group.begin(), group.end(), [](const BenchmarkResult* a, const BenchmarkResult* b) {
+                    return a->threads < b->threads;
+                });
+                for (const auto* g : group)
+                {
+                    auto s = std::find_if(results->begin(), results->end(), [g](const BenchmarkResult& other) {
+                        return !other.weak && other.function_name == g->function_name &&
+                               other.config_str == g->base_config && other.threads == g->threads;
+                    });
+                    auto strong = s == results->end()
+                                      ? std::string("- | -")
+                                      : std::format("{:.2f}x | {:.1f}", s->speedup, s->parallel_efficiency * 100.0);
+                    output += std::format("| {} | {} | {} | {:.2f}x | {} | {} | {:.2f} | {:.2f}x | {:.1f} |\n",
+                                          g->function_name, g->base_config, g->threads,
+                                          static_cast<double>(g->threads) / smallest, strong,
+                                          g->config_str, g->work_scale, g->speedup, g->parallel_efficiency * 100.0);
+                    done.push_back(g);
+                }
+            }
+        }
+        output += "\n";
+    }
+
+    // SMT comparison: the same thread count packed onto SMT siblings against one thread per
+    // physical core; a negative gain means the siblings compete for the core's units
+    std::string smt;
+    bool skipped = false;
+    for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+    {
+        for (const auto& r : *results)
+        {
+            if (r.smt != "siblings" || r.threads < 2)
+            {
+                continue;
+            }
+            // config_str ends with the placement tag; the rest identifies the size and modes
+            const auto base = r.config_str.substr(0, r.config_str.size() - std::string(",smt=siblings").size());
+            const auto cores_config = base + ",smt=cores";
+            auto cores = std::find_if(results->begin(), results->end(), [&r, &cores_config](const BenchmarkResult& other) {
+                return other.smt == "cores" && other.function_name == r.function_name &&
+                       other.threads == r.threads && other.config_str == cores_config;
+            });
+            // No cores run: more threads than physical cores
+            if (cores == results->end())
+            {
+                smt += std::format("| {} | {} | {} | - | {} | - | {:.2f} | - |\n",
+                                   r.function_name, base, r.threads, r.placement, r.gflops);
+                skipped = true;
+                continue;
+            }
+            smt += std::format("| {} | {} | {} | {} | {} | {:.2f} | {:.2f} | {:.1f} |\n",
+                               r.function_name, base, r.threads, cores->placement, r.placement, cores->gflops, r.gflops, r.smt_gain * 100.0);
+        }
+    }
+    if (!smt.empty())
+    {
+        output += "### SMT Comparison\n\n";
+        output += "| Function | Config | Threads | Cores Placement | Siblings Placement | Cores GFLOPS | Siblings GFLOPS | SMT Gain(%) |\n";
+        output += "|:---------|:-------|:--------|:----------------|:-------------------|:-------------|:----------------|:------------|\n";
+        output += smt + "\n";
+        if (skipped)
+        {
+            output += std::format("Rows without a cores run use more threads than the {} physical core(s), "
+                                  "so no placement has one thread per core and the comparison is skipped.\n\n",
+                                  report.system_info.physical_cores);
+        }
+    }
+
+    // Robust statistics over all timed samples
+    output += "### Statistics\n\n";
+    output += "| Function | Config | Samples | Median(ms) | StdDev(ms) | MAD(ms) | P5(ms) | P95(ms) | P99(ms) | CV(%) | GFLOPS 95% CI | Precision(%) | Ref Cycles | FLOPs/Cycle |\n";
+    output += "|:---------|:-------|:--------|:-----------|:-----------|:--------|:-------|:--------|:--------|:------|:--------------|:-------------|:-----------|:------------|\n";
+
+    for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+    {
+        for (const auto& r : *results)
+        {
+            output += std::format("| {} | {} | {} x {} | {:.6f} | {:.6f} | {:.6f} | {:.6f} | {:.6f} | {:.6f} | {:.2f} | [{:.2f}, {:.2f}] | {:.2f} | {:.0f} | {:.2f} |\n",
+                                  r.function_name, r.config_str, r.samples_ms.size(), r.repetitions,
+                                  r.median_time_ms, r.stddev_time_ms, r.mad_time_ms,
+                                  r.p5_time_ms, r.p95_time_ms, r.p99_time_ms, r.cv * 100.0,
+                                  r.gflops_ci_lower, r.gflops_ci_upper, r.precision * 100.0,
+                                  r.cycles_per_call, r.flops_per_cycle);
+        }
+    }
+    output += "\n";
+
+    // Roofline: measured machine roofs and each kernel's share of its bound
+    if (!report.peaks.empty())
+    {
+        output += "### Roofline\n\n";
+        // Each kernel is bounded by the roofs measured at its own thread count
+        for (const auto& peaks : report.peaks)
+        {
+            output += std::format("- **Peak FMA** ({} threads): {:.1f} GFLOPS double, {:.1f} GFLOPS single\n",
+                                  peaks.threads, peaks.peak_gflops_double, peaks.peak_gflops_single);
+            output += std::format("- **Triad Bandwidth** ({} threads): L2 {:.1f} GB/s, L3 {:.1f} GB/s, DRAM {:.1f} GB/s\n",
+                                  peaks.threads, peaks.l2_gbs, peaks.l3_gbs, peaks.dram_gbs);
+        }
+        output += "\n";
+        output += "| Function | Config | Threads | Bytes | AI (FLOPs/B) | GFLOPS | Bound (GFLOPS) | Limit | % of Roofline |\n";
+        output += "|:---------|:-------|:--------|:------|:-------------|:-------|:---------------|:------|:--------------|\n";
+
+        for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+        {
+            for (const auto& r : *results)
+            {
+                output += std::format("| {} | {} | {} | {} | {:.3f} | {:.2f} | {:.2f} | {} | {:.1f} |\n",
+                                      r.function_name, r.config_str, r.threads, r.bytes_read + r.bytes_written,
+                                      r.arithmetic_intensity,
+                                      r.gflops, r.roofline_gflops, r.roofline_limit, r.roofline_pct);
+            }
+        }
+        output += "\n";
+    }
+
+    // Hardware counters per call, only when they could be collected
+    const bool has_perf = std::ranges::any_of(
+        std::array{&report.level1_results, &report.level2_results, &report.level3_results},
+        [](const auto* results) { return std::ranges::any_of(*results, [](const auto& r) { return r.perf.has_value(); }); });
+    if (has_perf)
+    {
+        output += "### Hardware Counters (per call)\n\n";
+        output += "| Function | Config | Cycles | Instructions | IPC | LLC Loads | LLC Miss(%) | dTLB Miss(%) | FP Width(bits) |\n";
+        output += "|:---------|:-------|:-------|:-------------|:----|:----------|:------------|:-------------|:---------------|\n";
+
+        for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+        {
+            for (const auto& r : *results)
+            {
+                if (!r.perf)
+                {
+                    continue;
+                }
+                const auto& p = *r.perf;
+                output += std::format("| {} | {} | {:.0f} | {:.0f} | {:.2f} | {:.0f} | {:.2f} | {:.3f} | {:.0f} |\n",
+                                      r.function_name, r.config_str,
+                                      p.get(utils::PerfEvent::cycles), p.get(utils::PerfEvent::instructions), p.ipc(),
+                                      p.get(utils::PerfEvent::llc_loads), p.llc_miss_rate() * 100.0,
+                                      p.dtlb_miss_rate() * 100.0, p.vector_width_bits(r.real_bits));
+            }
+        }
+        output += "\n";
+    }
+
+    // Setup vs measured time, to show where the wall time of a run went,
+    // plus the operand checksum for reproducing a result with the same seed
+    output += "### Fixture Details\n\n";
+    output += "| Function | Config | Threads | Setup(ms) | Warmup(ms) | Measured(ms) | Flush(ms) | Checksum | Placement | CPUs Used |\n";
+    output += "|:---------|:-------|:--------|:----------|:-----------|:-------------|:----------|:---------|:----------|:----------|\n";
+
+    for (const auto* results : {&report.level1_results, &report.level2_results, &report.level3_results})
+    {
+        for (const auto& r : *results)
+        {
+            output += std::format("| {} | {} | {} | {:.3f} | {:.3f} | {:.3f} | {:.3f} | {:016x} | {} | {} |\n",
+                                  r.function_name, r.config_str, r.threads,
+                                  r.setup_time_ms, r.warmup_time_ms, r.measured_time_ms,
+                                  r.flush_time_ms, r.operand_checksum, r.placement, r.cpus_used);
+        }
+    }
+    output += "\n";
+
     return output;
 }
 
@@ -278,32 +1434,133 @@ std::string OutputFormatter::to_csv(const BenchmarkReport& report)
 {
     std::string output;
 
-    // CSV header
-    output += "Level,Function,Config,Threads,Min(ms),Avg(ms),Max(ms),GFLOPS\n";
+    const bool warm_cold = report.config.warm_cold;
+    const bool perf = report.config.perf_counters;
+    const bool roofline = !report.peaks.empty();
+    const bool scaling = report.thread_counts.size() > 1;
+    const bool throughput = report.config.instances > 1;
+    const bool weak = scaling && report.config.scaling != "strong";
+    const bool smt = report.config.smt_compare;
 
-    // Level 1 results
-    for (const auto& r : report.level1_results)
+    // CSV header
+    output += "Level,Function,Type,Config,Layout,Threads,Min(ms),Avg(ms),Max(ms),GFLOPS,Bytes Read,Bytes Written,GB/s,"
+              "Median(ms),StdDev(ms),MAD(ms),P5(ms),P95(ms),P99(ms),CV,GFLOPS CI Low,GFLOPS CI High,Precision,Samples,Repetitions,Ref Cycles,FLOPs/Cycle,"
+              "Setup(ms),Warmup(ms),Measured(ms),Flush(ms),Seed,Checksum,Placement,CPUs Used";
+    if (warm_cold)
     {
-        output += std::format("1,{},{},{},{:.3f},{:.3f},{:.3f},{:.2f}\n",
-                              r.function_name, r.config_str, r.threads,
-                              r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops);
+        output += ",Warm(ms),Cold(ms),Warm GFLOPS,Cold GFLOPS,Cold/Warm";
     }
-
-    // Level 2 results
-    for (const auto& r : report.level2_results)
+    if (roofline)
     {
-        output += std::format("2,{},{},{},{:.3f},{:.3f},{:.3f},{:.2f}\n",
-                              r.function_name, r.config_str, r.threads,
-                              r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops);
+        output += ",AI(FLOPs/B),Roofline GFLOPS,Roofline Limit,Roofline(%)";
     }
-
-    // Level 3 results
-    for (const auto& r : report.level3_results)
+    if (perf)
+    {
+        output += ",Cycles,Instructions,IPC,LLC Loads,LLC Misses,dTLB Loads,dTLB Misses,FP Scalar,FP 128,FP 256,FP 512,FP Width(bits)";
+    }
+    if (scaling)
     {
-        output += std::format("3,{},{},{},{:.3f},{:.3f},{:.3f},{:.2f}\n",
-                              r.function_name, r.config_str, r.threads,
-                              r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops);
+        output += ",Speedup,Efficiency,Knee Threads";
     }
+    if (weak)
+    {
+        output += ",Weak,Base Config,Work Scale";
+    }
+    if (smt)
+    {
+        output += ",SMT,SMT Gain(%)";
+    }
+    if (throughput)
+    {
+        output += ",Instances,Isolated(ms),Instance Median(ms),Instance P95(ms),Instance P99(ms),Instance Spread,"
+                  "Slowdown,Isolated GFLOPS,Aggregate GFLOPS";
+    }
+    output += ",Samples(ms)\n";
+
+    auto format_rows = [&output, &report, warm_cold, perf, roofline, scaling, throughput, weak, smt](int level, const std::vector<BenchmarkResult>& results)
+    {
+        for (const auto& r : results)
+        {
+            output += std::format("{},{},{},\"{}\",\"{}\",{},{:.6f},{:.6f},{:.6f},{:.2f},{},{},{:.2f},",
+                                  level, r.function_name, r.precision_char, r.config_str, r.layout, r.threads,
+                                  r.min_time_ms, r.avg_time_ms, r.max_time_ms, r.gflops,
+                                  r.bytes_read, r.bytes_written, r.gbs);
+            output += std::format("{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.4f},{:.2f},{:.2f},{:.4f},{},{},{:.0f},{:.4f},",
+                                  r.median_time_ms, r.stddev_time_ms, r.mad_time_ms,
+                                  r.p5_time_ms, r.p95_time_ms, r.p99_time_ms, r.cv,
+                                  r.gflops_ci_lower, r.gflops_ci_upper, r.precision, r.samples_ms.size(),
+                                  r.repetitions, r.cycles_per_call, r.flops_per_cycle);
+            // CPU lists contain commas, so they are quoted
+            output += std::format("{:.3f},{:.3f},{:.3f},{:.3f},{},{:016x},\"{}\",\"{}\"",
+                                  r.setup_time_ms, r.warmup_time_ms, r.measured_time_ms,
+                                  r.flush_time_ms, report.seed, r.operand_checksum, r.placement, r.cpus_used);
+            if (warm_cold)
+            {
+                output += std::format(",{:.6f},{:.6f},{:.2f},{:.2f},{:.3f}",
+                                      r.warm_time_ms, r.cold_time_ms, r.warm_gflops, r.cold_gflops,
+                                      r.cold_warm_ratio());
+            }
+            if (roofline)
+            {
+                output += std::format(",{:.4f},{:.2f},{},{:.1f}",
+                                      r.arithmetic_intensity, r.roofline_gflops,
+                                      r.roofline_limit, r.roofline_pct);
+            }
+            if (perf)
+            {
+                // Per-call event counts; empty when counters were unavailable
+                if (r.perf)
+                {
+                    const auto& p = *r.perf;
+                    for (std::size_t e = 0; e < utils::perf_event_count; ++e)
+                    {
+                        output += p.valid[e] ? std::format(",{:.1f}", p.values[e]) : ",";
+                        if (static_cast<utils::PerfEvent>(e) == utils::PerfEvent::instructions)
+                        {
+                            output += std::format(",{:.3f}", p.ipc());
+                        }
+                    }
+                    output += std::format(",{:.1f}", p.vector_width_bits(r.real_bits));
+                }
+                else
+                {
+                    output += std::string(12, ',');
+                }
+            }
+
+            if (scaling)
+            {
+                output += std::format(",{:.3f},{:.3f},{}", r.speedup, r.parallel_efficiency, r.knee_threads);
+            }
+            if (weak)
+            {
+                output += std::format(",{},\"{}\",{:.3f}", r.weak ? "yes" : "no", r.base_config, r.work_scale);
+            }
+            if (smt)
+            {
+                output += std::format(",{},{:.2f}", r.smt, r.smt_gain * 100.0);
+            }
+            if (throughput)
+            {
+                output += std::format(",{},{:.6f},{:.6f},{:.6f},{:.6f},{:.3f},{:.3f},{:.2f},{:.2f}",
+                                      r.instances, r.isolated_median_ms, r.instance_median_ms, r.instance_p95_ms,
+                                      r.instance_p99_ms, r.instance_spread, r.interference_slowdown,
+                                      r.isolated_gflops, r.throughput_gflops);
+            }
+
+            // Raw samples, semicolon-separated so the row stays one CSV record
+            output += ",";
+            for (std::size_t i = 0; i < r.samples_ms.size(); ++i)
+            {
+                output += std::format("{}{:.6f}", i == 0 ? "" : ";", r.samples_ms[i]);
+            }
+            output += "\n";
+        }
+    };
+
+    format_rows(1, report.level1_results);
+    format_rows(2, report.level2_results);
+    format_rows(3, report.level3_results);
 
     return output;
 }
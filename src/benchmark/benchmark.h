@@ -3,14 +3,22 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "benchmark/blas_functions.h"
+#include "benchmark/kernel_registry.h"
 #include "config/config_parser.h"
+#include "utils/affinity.h"
+#include "utils/cache_flusher.h"
+#include "utils/perf_counters.h"
+#include "utils/roofline.h"
 #include "utils/system_info.h"
+#include "utils/timer.h"
 
 namespace blas_benchmark
 {
@@ -19,13 +27,102 @@ namespace blas_benchmark
 struct BenchmarkResult
 {
     std::string function_name;
+    std::string operation;     // Precision-independent name, e.g. "gemm"
+    char precision_char{'d'};  // BLAS prefix of the kernel
+    std::size_t real_bits{64}; // Width of one real component
     std::string config_str;
+    std::string layout;        // Storage layout tag of gemv/gemm (e.g. "C/TN/+8"), else empty
     int threads{0};
     double min_time_ms{0.0};
     double avg_time_ms{0.0};
     double max_time_ms{0.0};
     double gflops{0.0};
+    std::size_t bytes_read{0};    // Modelled memory traffic per call
+    std::size_t bytes_written{0};
+    double gbs{0.0};              // Effective bandwidth from the mean time
     std::size_t flops{0};
+
+    // Every timed sample (ms) of the primary series, in run order
+    std::vector<double> samples_ms;
+
+    // Robust statistics over samples_ms
+    double median_time_ms{0.0};
+    double stddev_time_ms{0.0};
+    double mad_time_ms{0.0};
+    double p5_time_ms{0.0};
+    double p95_time_ms{0.0};
+    double p99_time_ms{0.0};
+    double cv{0.0};              // Coefficient of variation of the time
+    double gflops_ci_lower{0.0}; // Bootstrap 95% CI of GFLOPS (from the mean time)
+    double gflops_ci_upper{0.0};
+    std::size_t repetitions{1};  // Back-to-back calls per timed sample
+    double cycles_per_call{0.0}; // Median time in TSC reference cycles (0 without invariant TSC)
+    double flops_per_cycle{0.0};
+    double precision{0.0};       // Achieved relative 95% CI half-width of the median time
+
+    // Hardware counters per call over the timed samples (when enabled and available)
+    std::optional<utils::PerfCounts> perf;
+
+    // Roofline position (filled in roofline mode)
+    double arithmetic_intensity{0.0}; // FLOPs per modelled byte
+    double roofline_gflops{0.0};      // Attainable GFLOPS at this intensity
+    double roofline_pct{0.0};         // Achieved GFLOPS as % of the bound
+    std::string roofline_limit;       // Roof that bounds the kernel
+
+    // Thread scaling against the smallest count of a thread sweep (filled when sweeping)
+    double speedup{0.0};             // Median time at the smallest count / median time here
+    double parallel_efficiency{0.0}; // speedup / (threads / smallest count)
+    int knee_threads{0};             // Count beyond which extra threads stop paying off
+
+    // Weak scaling series (scaling = "weak" or "both"): sizes grow with the thread count and
+    // the speedup fields above hold the scaled speedup, from the time per unit of base work
+    bool weak{false};
+    std::string base_config; // Config at the smallest count, shared by one weak series
+    double work_scale{1.0};  // FLOPs relative to the smallest count of the series
+
+    // Thread placement: pinning policy with its CPU set (e.g. "compact 0-3" or "none"),
+    // and the CPUs the process threads last ran on, read from /proc/self/task after the run
+    std::string placement;
+    std::string cpus_used;
+
+    // SMT comparison: "cores" (one hardware thread per physical core) or "siblings"
+    // (packed onto SMT siblings) at the same thread count, and the siblings' GFLOPS
+    // relative to the cores run, as a fraction (negative when SMT hurts)
+    std::string smt;
+    double smt_gain{0.0};
+
+    // Throughput mode: `instances` concurrent copies of the call, each on its own thread and
+    // fixture, against one copy alone under the same conditions (filled when instances > 1)
+    int instances{1};
+    double isolated_median_ms{0.0};    // One instance alone
+    double instance_median_ms{0.0};    // Over the samples of all concurrent instances
+    double instance_p95_ms{0.0};
+    double instance_p99_ms{0.0};
+    double instance_spread{0.0};       // Slowest / fastest instance median
+    double isolated_gflops{0.0};       // One instance alone, from its wall time
+    double throughput_gflops{0.0};     // FLOPs of all instances over the concurrent wall time
+    double interference_slowdown{0.0}; // instance_median_ms / isolated_median_ms
+
+    // Time spent outside the timed calls
+    double setup_time_ms{0.0};    // Operand allocation and initialization
+    double warmup_time_ms{0.0};   // Warmup iterations, run once per fixture
+    double measured_time_ms{0.0}; // Sum of all timed calls
+    double flush_time_ms{0.0};    // Cache flushes before warmup and timed calls
+
+    // Checksum of the initial operand contents, for exact reruns with the same seed
+    std::uint64_t operand_checksum{0};
+
+    // Warm- and cold-cache regimes (filled when warm/cold reporting is enabled)
+    double warm_time_ms{0.0};
+    double cold_time_ms{0.0};
+    double warm_gflops{0.0};
+    double cold_gflops{0.0};
+
+    // Cache sensitivity: how much slower a cold call is than a warm one
+    [[nodiscard]] double cold_warm_ratio() const
+    {
+        return warm_time_ms > 0.0 ? cold_time_ms / warm_time_ms : 0.0;
+    }
 };
 
 // Complete benchmark report
@@ -36,6 +133,12 @@ struct BenchmarkReport
     std::vector<BenchmarkResult> level2_results;
     std::vector<BenchmarkResult> level3_results;
     config::BenchmarkConfig config;
+    std::vector<int> thread_counts; // Thread counts run, in order (several in a sweep)
+    std::uint64_t seed{0}; // Operand RNG seed actually used
+    double timer_overhead_ns{0.0}; // Subtracted from every timed sample
+    std::string timer;             // Timer source used for samples
+    double tsc_ghz{0.0};           // Calibrated TSC frequency, 0 without invariant TSC
+    std::vector<utils::MachinePeaks> peaks; // Measured in roofline mode, one per thread count
 };
 
 // Main benchmark runner class
@@ -69,14 +172,87 @@ private:
     config::BenchmarkConfig m_config;
     utils::SystemInfoCollector m_info_collector;
     std::size_t m_cache_size{16 * 1024 * 1024}; // Default 16MB
+    std::uint64_t m_seed{0};
+    double m_timer_overhead_ns{0.0};
+    utils::TimerSource m_timer_source{utils::TimerSource::chrono};
+    bool m_perf_counters{false}; // Enabled and perf_event_open works
+    std::optional<utils::MachinePeaks> m_peaks;
+    std::unique_ptr<utils::CacheFlusher> m_flusher;      // Allocated once when flushing is enabled
+    std::unique_ptr<utils::CacheFlusher> m_warm_flusher; // Warm series in warm/cold mode
+    utils::PinSpec m_pin;
+    std::vector<int> m_pinned_cpus; // CPU set of the current thread count (empty without pinning)
+    std::string m_placement;        // Recorded with every result
+    bool m_smt_compare{false};      // SMT comparison enabled and the machine has siblings
+    double m_weak_factor{0.0};      // Thread count / smallest count during a weak scaling pass, else 0
 
-    // Run a single benchmark function and collect timing statistics
-    template<typename Func>
+    // Run every configured level at the current thread count
+    void run_levels(BenchmarkReport& report);
+
+    // Run every configured level twice at the current thread count: pinned one thread per
+    // physical core, then packed onto SMT siblings; results are tagged with the placement
+    void run_smt_comparison(BenchmarkReport& report);
+
+    // Tag the results from `first` on as weak scaling results: `config_str` is the scaled
+    // config they were run with and `base_config` the same config at the smallest count
+    void mark_weak(std::vector<BenchmarkResult>& results, std::size_t first, const std::string& config_str,
+                   const std::string& base_config) const;
+
+    // Thread counts to run: the sweep with "physical"/"logical" resolved, or `threads`
+    [[nodiscard]] std::vector<int> resolve_thread_counts(const utils::SystemInfo& info) const;
+
+    // Pin the main thread and the OpenBLAS pool for `threads` threads under the pinning policy
+    void apply_pinning(int threads);
+
+    // Record where the process threads ran and warn about any thread outside the pinned set
+    void verify_placement(BenchmarkResult& result) const;
+
+    // Throughput mode: time the kernel alone on one instance thread, then on
+    // m_config.instances threads at once, and fill the throughput fields of `result`
+    void run_throughput(const KernelDescriptor& kernel, const ProblemSize& size, std::size_t repetitions,
+                        BenchmarkResult& result);
+
+    // Build, warm up and time one fixture per instance, each on its own (pinned) thread;
+    // instances start together once all are warm. Returns the samples of each instance
+    // and sets `wall_ms` to the time from the start until the last instance finished
+    [[nodiscard]] std::vector<std::vector<double>> run_instances(const KernelDescriptor& kernel, const ProblemSize& size,
+                                                                 int instances, std::size_t samples,
+                                                                 std::size_t repetitions, double& wall_ms) const;
+
+    // Fill the BLAS mode arguments (side/uplo/trans/diag) from the config
+    void set_modes(ProblemSize& size) const;
+
+    // The problem size once per [layout] combination (order, transposes, ld padding)
+    [[nodiscard]] std::vector<ProblemSize> layout_variants(const ProblemSize& size) const;
+
+    // Run the registered kernels named in `functions` at one problem size; kernels
+    // with a layout tag run once per distinct layout
+    void run_kernels(BlasLevel level, const std::vector<std::string>& functions,
+                     const ProblemSize& size, const std::string& config_str,
+                     std::vector<BenchmarkResult>& results);
+
+    // Level 2/3 kernels one at a time, each config holding only the dimensions it reads;
+    // `base` is the configured size that weak-scaled runs are matched on
+    void run_matrix_kernels(BlasLevel level, const std::vector<std::string>& functions,
+                            const ProblemSize& size, const ProblemSize& base,
+                            std::vector<BenchmarkResult>& results);
+
+    // Build the kernel's fixture, warm it up once, then time it for the configured cycles
     BenchmarkResult run_single_benchmark(
-        const std::string& name,
-        const std::string& config_str,
-        Func&& benchmark_func,
-        std::size_t flops_count);
+        const KernelDescriptor& kernel,
+        const ProblemSize& size,
+        const std::string& config_str);
+
+    // Time the configured number of cycles, preparing caches with the given flusher
+    // In adaptive mode, sample until the target precision, max cycles or time budget is hit
+    std::vector<double> time_cycles(BenchmarkFixture& fixture, utils::CacheFlusher* flusher,
+                                    std::size_t repetitions, utils::PerfCounters* counters = nullptr);
+
+    // Pick the number of back-to-back calls per sample so a sample lasts at least
+    // min_sample_time_ms; always 1 when the flusher must start every call cold
+    [[nodiscard]] std::size_t calibrate_repetitions(BenchmarkFixture& fixture, utils::CacheFlusher* flusher) const;
+
+    // Relative half-width of the bootstrap 95% CI of the median
+    [[nodiscard]] double median_precision(const std::vector<double>& times, std::size_t resamples) const;
 };
 
 // Output formatter for different formats
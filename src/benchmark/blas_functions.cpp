@@ -1,12 +1,17 @@
 #include "benchmark/blas_functions.h"
 
 #include <algorithm>
+#include <cctype>
 #include <cmath>
-#include <random>
+#include <complex>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <spdlog/spdlog.h>
 
+#include "utils/random.h"
 #include "utils/timer.h"
 
 namespace blas_benchmark
@@ -15,254 +20,831 @@ namespace blas_benchmark
 namespace
 {
 
-// Generate random data for testing
+// Builds the operands of one fixture and tracks setup time and checksum
+// The i-th operand generated uses stream seed + i, so contents depend only on
+// the seed and the generation order within the factory
+// Complex operands are filled as interleaved (real, imaginary) pairs
 template<typename T>
-std::vector<T> generate_random_data(std::size_t size, T min_val = static_cast<T>(-1.0), T max_val = static_cast<T>(1.0))
+class OperandBuilder
 {
-    std::vector<T> data(size);
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    
-    if constexpr (std::is_floating_point_v<T>)
+public:
+    using Real = typename BlasPrecisionTraits<T>::real_type;
+    static constexpr std::size_t components = sizeof(T) / sizeof(Real);
+
+    explicit OperandBuilder(std::uint64_t seed)
+        : m_seed(seed)
     {
-        std::uniform_real_distribution<T> dist(min_val, max_val);
-        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+        m_timer.start();
     }
-    else
+
+    // Allocate and fill one operand with uniform values in [min_val, max_val)
+    // (per component for complex types)
+    // Left uninitialized until the parallel fill, which first-touches every page
+    OperandBuffer<T> random(std::size_t size,
+                            Real min_val = static_cast<Real>(-1.0), Real max_val = static_cast<Real>(1.0))
     {
-        std::uniform_int_distribution<> dist(static_cast<int>(min_val), static_cast<int>(max_val));
-        std::generate(data.begin(), data.end(), [&]() { return static_cast<T>(dist(gen)); });
+        OperandBuffer<T> data(size);
+        std::uint64_t sum = utils::fill_uniform(reinterpret_cast<Real*>(data.data()), size * components,
+                                                m_seed + m_count, min_val, max_val);
+        m_checksum = m_checksum * 31 + sum;
+        ++m_count;
+
+        // Moving the vector into the operand set keeps its buffer address
+        m_regions.push_back({data.data(), size * sizeof(T)});
+        return data;
     }
-    
-    return data;
-}
 
-} // anonymous namespace
+    // Square matrix with off-diagonal entries in +-1/(2 order) and diagonal entries
+    // near 1.5: every row is strictly diagonally dominant in either triangle, so
+    // ||A|| <= 2 and ||A^-1|| <= 2 whichever triangle and transpose BLAS reads
+    OperandBuffer<T> diagonally_dominant(std::size_t order)
+    {
+        const auto bound = static_cast<Real>(0.5 / static_cast<double>(order));
+        OperandBuffer<T> data = random(order * order, -bound, bound);
+        for (std::size_t i = 0; i < order; ++i)
+        {
+            data[i * order + i] += static_cast<Real>(1.5);
+        }
+        return data;
+    }
+
+    // Stop the setup timer and wrap the kernel (and the reset of operands it
+    // overwrites, if any) into a fixture
+    BenchmarkFixture build(BenchmarkFixture::Kernel kernel, BenchmarkFixture::Reset reset = {},
+                           std::size_t reset_interval = 1)
+    {
+        m_timer.stop();
+        return BenchmarkFixture(std::move(kernel), m_timer.elapsed_ms(), m_checksum, std::move(m_regions),
+                                std::move(reset), reset_interval);
+    }
 
-// Benchmark runner functions for each BLAS operation
+private:
+    std::uint64_t m_seed;
+    std::uint64_t m_count{0};
+    std::uint64_t m_checksum{0};
+    std::vector<utils::MemoryRegion> m_regions;
+    utils::Timer m_timer;
+};
 
+// Triangular kernels (trmv/trsv/trmm/trsm) overwrite their right-hand side with
+// op(A)^(+-1) times it on every call; with ||op(A)||, ||op(A)^-1|| <= 2 it changes
+// by at most 2^interval before the fixture's untimed reset restores the pristine copy
+constexpr std::size_t triangular_refresh_interval = 8;
+
+// Update kernels (ger/syr/syr2) add alpha * (rank-1 or rank-2 term) to A on every
+// call; alternating the sign of alpha keeps A bounded however many calls run
 template<typename T>
-double benchmark_dot(std::size_t n, std::size_t warmup, std::size_t cycles, 
-                     bool flush_cache, std::size_t cache_size)
-{
-    // Allocate and initialize data
-    auto x = generate_random_data<T>(n);
-    auto y = generate_random_data<T>(n);
-    
-    T result = static_cast<T>(0);
-    
-    // Warmup runs
-    for (std::size_t i = 0; i < warmup; ++i)
+T alternating_alpha(bool& positive)
+{
+    positive = !positive;
+    return positive ? static_cast<T>(0.5) : static_cast<T>(-0.5);
+}
+
+// Storage of a general matrix of `rows` x `cols` (as stored, i.e. before op())
+// whose leading dimension is padded by `ld_padding` elements
+struct MatrixLayout
+{
+    std::size_t ld{0};
+    std::size_t elements{0};
+};
+
+MatrixLayout matrix_layout(CBLAS_ORDER order, std::size_t rows, std::size_t cols, std::size_t ld_padding)
+{
+    if (order == CblasRowMajor)
     {
-        if (flush_cache)
-        {
-            utils::flush_cache(cache_size);
-        }
-        result = BlasWrapper<T>::dot(n, x.data(), 1, y.data(), 1);
+        std::size_t ld = cols + ld_padding;
+        return {ld, rows * ld};
     }
-    (void)result; // Suppress unused variable warning
-    
-    // Benchmark runs
+    std::size_t ld = rows + ld_padding;
+    return {ld, cols * ld};
+}
+
+} // anonymous namespace
+
+// BenchmarkFixture implementation
+
+BenchmarkFixture::BenchmarkFixture(Kernel kernel, double setup_time_ms, std::uint64_t operand_checksum,
+                                   std::vector<utils::MemoryRegion> operands, Reset reset,
+                                   std::size_t reset_interval)
+    : m_kernel(std::move(kernel))
+    , m_reset(std::move(reset))
+    , m_reset_interval(std::max<std::size_t>(reset_interval, 1))
+    , m_setup_time_ms(setup_time_ms)
+    , m_operand_checksum(operand_checksum)
+    , m_operands(std::move(operands))
+{
+}
+
+void BenchmarkFixture::warmup(std::size_t iterations, utils::CacheFlusher* flusher)
+{
     utils::Timer timer;
-    double total_time = 0.0;
-    
-    for (std::size_t i = 0; i < cycles; ++i)
+    timer.start();
+
+    for (std::size_t i = 0; i < iterations; ++i)
     {
-        if (flush_cache)
+        if (m_reset && i % m_reset_interval == 0)
+        {
+            m_reset();
+        }
+        if (flusher != nullptr)
         {
-            utils::flush_cache(cache_size);
+            flusher->prepare(m_operands);
         }
-        
-        timer.start();
-        result = BlasWrapper<T>::dot(n, x.data(), 1, y.data(), 1);
-        timer.stop();
-        
-        total_time += timer.elapsed_ms();
+        m_kernel();
     }
-    
-    return total_time / static_cast<double>(cycles);
+
+    timer.stop();
+    m_warmup_time_ms += timer.elapsed_ms();
 }
 
-template<typename T>
-double benchmark_axpy(std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size)
-{
-    auto x = generate_random_data<T>(n);
-    auto y = generate_random_data<T>(n);
-    T alpha = static_cast<T>(0.5);
-    
-    // Warmup runs
-    for (std::size_t i = 0; i < warmup; ++i)
+double BenchmarkFixture::run(utils::CacheFlusher* flusher, std::size_t repetitions, double overhead_ns,
+                             utils::TimerSource source, utils::PerfCounters* counters)
+{
+    // Restore first, so the flusher leaves the restored operands in the requested state
+    if (m_reset)
     {
-        if (flush_cache)
-        {
-            utils::flush_cache(cache_size);
-        }
-        BlasWrapper<T>::axpy(n, alpha, x.data(), 1, y.data(), 1);
+        m_reset();
     }
-    
-    // Benchmark runs
-    utils::Timer timer;
-    double total_time = 0.0;
-    
-    for (std::size_t i = 0; i < cycles; ++i)
+    if (flusher != nullptr)
     {
-        if (flush_cache)
-        {
-            utils::flush_cache(cache_size);
-        }
-        
-        timer.start();
-        BlasWrapper<T>::axpy(n, alpha, x.data(), 1, y.data(), 1);
-        timer.stop();
-        
-        total_time += timer.elapsed_ms();
+        flusher->prepare(m_operands);
     }
-    
-    return total_time / static_cast<double>(cycles);
+
+    repetitions = std::max<std::size_t>(repetitions, 1);
+
+    double batch_ns = source == utils::TimerSource::tsc
+                          ? time_batch<utils::CycleTimer>(repetitions, overhead_ns, counters)
+                          : time_batch<utils::Timer>(repetitions, overhead_ns, counters);
+    return batch_ns / static_cast<double>(repetitions) / 1000000.0;
 }
 
+// Fixture factories for each BLAS operation
+
 template<typename T>
-double benchmark_scal(std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size)
-{
-    auto x = generate_random_data<T>(n);
-    T alpha = static_cast<T>(2.0);
-    
-    // Warmup runs
-    for (std::size_t i = 0; i < warmup; ++i)
-    {
-        if (flush_cache)
+BenchmarkFixture make_dot_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        volatile auto result = std::real(BlasWrapper<T>::dot(n, ops->x.data(), 1, ops->y.data(), 1));
+        (void)result;
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_dotc_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        volatile auto result = std::real(BlasWrapper<T>::dotc(n, ops->x.data(), 1, ops->y.data(), 1));
+        (void)result;
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_axpy_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        T alpha = static_cast<T>(0.5);
+        BlasWrapper<T>::axpy(n, alpha, ops->x.data(), 1, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_scal_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+
+    // Alternate between 2.0 and 0.5 so repeated calls on the same buffer
+    // neither overflow nor underflow (both are exact in binary floating point)
+    auto grow = std::make_shared<bool>(true);
+
+    return builder.build([ops, grow, n]() {
+        T alpha = *grow ? static_cast<T>(2.0) : static_cast<T>(0.5);
+        *grow = !*grow;
+        BlasWrapper<T>::scal(n, alpha, ops->x.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_nrm2_fixture(std::size_t n, bool large_magnitude, std::uint64_t seed)
+{
+    // Squares of these overflow: 1e400 > DBL_MAX, 1e60 > FLT_MAX
+    const T scale = large_magnitude ? static_cast<T>(std::is_same_v<T, double> ? 1e200 : 1e30)
+                                    : static_cast<T>(1.0);
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n, -scale, scale);
+
+    return builder.build([ops, n]() {
+        volatile T result = BlasWrapper<T>::nrm2(n, ops->x.data(), 1);
+        (void)result;
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_asum_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+
+    return builder.build([ops, n]() {
+        volatile T result = BlasWrapper<T>::asum(n, ops->x.data(), 1);
+        (void)result;
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_iamax_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+
+    return builder.build([ops, n]() {
+        volatile std::size_t result = BlasWrapper<T>::iamax(n, ops->x.data(), 1);
+        (void)result;
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_copy_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        BlasWrapper<T>::copy(n, ops->x.data(), 1, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_swap_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        BlasWrapper<T>::swap(n, ops->x.data(), 1, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_rot_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        // 3-4-5 rotation: c^2 + s^2 = 1
+        T c = static_cast<T>(0.6);
+        T s = static_cast<T>(0.8);
+        BlasWrapper<T>::rot(n, ops->x.data(), 1, ops->y.data(), 1, c, s);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_rotm_fixture(std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n]() {
+        // flag = -1: full H = [h11 h12; h21 h22], the same rotation as in make_rot_fixture
+        const T param[5] = {static_cast<T>(-1.0), static_cast<T>(0.6), static_cast<T>(-0.8),
+                            static_cast<T>(0.8), static_cast<T>(0.6)};
+        BlasWrapper<T>::rotm(n, ops->x.data(), 1, ops->y.data(), 1, param);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_gemv_fixture(std::size_t m, std::size_t n, CBLAS_ORDER order, CBLAS_TRANSPOSE trans,
+                                   std::size_t ld_padding, std::uint64_t seed)
+{
+    MatrixLayout a = matrix_layout(order, m, n, ld_padding);
+    std::size_t x_len = trans == CblasNoTrans ? n : m;
+    std::size_t y_len = trans == CblasNoTrans ? m : n;
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(a.elements);
+    ops->x = builder.random(x_len);
+    ops->y = builder.random(y_len);
+
+    return builder.build([ops, m, n, order, trans, lda = a.ld]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::gemv(order, trans, m, n, alpha, ops->a.data(), static_cast<int>(lda),
+                             ops->x.data(), 1, beta, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_ger_fixture(std::size_t m, std::size_t n, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(m * n);
+    ops->x = builder.random(m);
+    ops->y = builder.random(n);
+    auto positive = std::make_shared<bool>(false);
+
+    return builder.build([ops, positive, m, n]() {
+        T alpha = alternating_alpha<T>(*positive);
+        BlasWrapper<T>::ger(CblasRowMajor, m, n, alpha, ops->x.data(), 1, ops->y.data(), 1,
+                            ops->a.data(), static_cast<int>(n));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_symv_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * n);
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n, uplo]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::symv(CblasRowMajor, uplo, n, alpha, ops->a.data(), static_cast<int>(n),
+                             ops->x.data(), 1, beta, ops->y.data(), 1);
+    });
+}
+
+namespace
+{
+
+template<typename T, bool Solve>
+BenchmarkFixture make_triangular_vector_fixture(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                                CBLAS_DIAG diag, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.diagonally_dominant(n);
+    ops->x = builder.random(n);
+    ops->y = ops->x; // Pristine x, not touched by the kernel
+
+    auto reset = [ops]() { std::copy(ops->y.begin(), ops->y.end(), ops->x.begin()); };
+    return builder.build([ops, n, uplo, trans, diag]() {
+        if constexpr (Solve)
         {
-            utils::flush_cache(cache_size);
+            BlasWrapper<T>::trsv(CblasRowMajor, uplo, trans, diag, n, ops->a.data(), static_cast<int>(n),
+                                 ops->x.data(), 1);
         }
-        BlasWrapper<T>::scal(n, alpha, x.data(), 1);
-    }
-    
-    // Benchmark runs
-    utils::Timer timer;
-    double total_time = 0.0;
-    
-    for (std::size_t i = 0; i < cycles; ++i)
-    {
-        if (flush_cache)
+        else
         {
-            utils::flush_cache(cache_size);
+            BlasWrapper<T>::trmv(CblasRowMajor, uplo, trans, diag, n, ops->a.data(), static_cast<int>(n),
+                                 ops->x.data(), 1);
         }
-        
-        timer.start();
-        BlasWrapper<T>::scal(n, alpha, x.data(), 1);
-        timer.stop();
-        
-        total_time += timer.elapsed_ms();
-    }
-    
-    return total_time / static_cast<double>(cycles);
+    }, reset, triangular_refresh_interval);
 }
 
+} // anonymous namespace
+
 template<typename T>
-double benchmark_gemv(std::size_t m, std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size)
-{
-    auto a = generate_random_data<T>(m * n);
-    auto x = generate_random_data<T>(n);
-    auto y = generate_random_data<T>(m);
-    T alpha = static_cast<T>(1.0);
-    T beta = static_cast<T>(0.0);
-    
-    // Warmup runs
-    for (std::size_t i = 0; i < warmup; ++i)
-    {
-        if (flush_cache)
+BenchmarkFixture make_trmv_fixture(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                   std::uint64_t seed)
+{
+    return make_triangular_vector_fixture<T, false>(n, uplo, trans, diag, seed);
+}
+
+template<typename T>
+BenchmarkFixture make_trsv_fixture(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                   std::uint64_t seed)
+{
+    return make_triangular_vector_fixture<T, true>(n, uplo, trans, diag, seed);
+}
+
+template<typename T>
+BenchmarkFixture make_syr_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * n);
+    ops->x = builder.random(n);
+    auto positive = std::make_shared<bool>(false);
+
+    return builder.build([ops, positive, n, uplo]() {
+        T alpha = alternating_alpha<T>(*positive);
+        BlasWrapper<T>::syr(CblasRowMajor, uplo, n, alpha, ops->x.data(), 1, ops->a.data(), static_cast<int>(n));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_syr2_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed)
+{
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * n);
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+    auto positive = std::make_shared<bool>(false);
+
+    return builder.build([ops, positive, n, uplo]() {
+        T alpha = alternating_alpha<T>(*positive);
+        BlasWrapper<T>::syr2(CblasRowMajor, uplo, n, alpha, ops->x.data(), 1, ops->y.data(), 1,
+                             ops->a.data(), static_cast<int>(n));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_gbmv_fixture(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku,
+                                   CBLAS_TRANSPOSE trans, std::uint64_t seed)
+{
+    // Row-major band storage: one row of kl + ku + 1 diagonals per matrix row
+    std::size_t lda = kl + ku + 1;
+    std::size_t x_len = trans == CblasNoTrans ? n : m;
+    std::size_t y_len = trans == CblasNoTrans ? m : n;
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(m * lda);
+    ops->x = builder.random(x_len);
+    ops->y = builder.random(y_len);
+
+    return builder.build([ops, m, n, kl, ku, trans, lda]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::gbmv(CblasRowMajor, trans, m, n, kl, ku, alpha, ops->a.data(), static_cast<int>(lda),
+                             ops->x.data(), 1, beta, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_sbmv_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, std::uint64_t seed)
+{
+    // Row-major band storage of the `uplo` triangle: k + 1 diagonals per row
+    std::size_t lda = k + 1;
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * lda);
+    ops->x = builder.random(n);
+    ops->y = builder.random(n);
+
+    return builder.build([ops, n, k, uplo, lda]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::sbmv(CblasRowMajor, uplo, n, k, alpha, ops->a.data(), static_cast<int>(lda),
+                             ops->x.data(), 1, beta, ops->y.data(), 1);
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_gemm_fixture(std::size_t m, std::size_t n, std::size_t k, CBLAS_ORDER order,
+                                   CBLAS_TRANSPOSE trans_a, CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                   std::uint64_t seed)
+{
+    spdlog::debug("Preparing GEMM fixture: M={}, N={}, K={}", m, n, k);
+
+    // Transposed operands are stored with their dimensions swapped
+    MatrixLayout a = trans_a == CblasNoTrans ? matrix_layout(order, m, k, ld_padding)
+                                             : matrix_layout(order, k, m, ld_padding);
+    MatrixLayout b = trans_b == CblasNoTrans ? matrix_layout(order, k, n, ld_padding)
+                                             : matrix_layout(order, n, k, ld_padding);
+    MatrixLayout c = matrix_layout(order, m, n, ld_padding);
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(a.elements);
+    ops->b = builder.random(b.elements);
+    ops->c = builder.random(c.elements);
+
+    return builder.build([ops, m, n, k, order, trans_a, trans_b, lda = a.ld, ldb = b.ld, ldc = c.ld]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::gemm(order, trans_a, trans_b,
+                             m, n, k, alpha, ops->a.data(), static_cast<int>(lda),
+                             ops->b.data(), static_cast<int>(ldb), beta, ops->c.data(), static_cast<int>(ldc));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_symm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   std::uint64_t seed)
+{
+    // Only the `uplo` triangle of A is referenced, so any square matrix is symmetric to BLAS
+    std::size_t order = side == CblasLeft ? m : n;
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(order * order);
+    ops->b = builder.random(m * n);
+    ops->c = builder.random(m * n);
+
+    return builder.build([ops, m, n, side, uplo, order]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::symm(CblasRowMajor, side, uplo, m, n, alpha, ops->a.data(), static_cast<int>(order),
+                             ops->b.data(), static_cast<int>(n), beta, ops->c.data(), static_cast<int>(n));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_syrk_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                   std::uint64_t seed)
+{
+    // A is n x k without transpose, k x n otherwise (row-major)
+    int lda = static_cast<int>(trans == CblasNoTrans ? k : n);
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * k);
+    ops->c = builder.random(n * n);
+
+    return builder.build([ops, n, k, uplo, trans, lda]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::syrk(CblasRowMajor, uplo, trans, n, k, alpha, ops->a.data(), lda,
+                             beta, ops->c.data(), static_cast<int>(n));
+    });
+}
+
+template<typename T>
+BenchmarkFixture make_syr2k_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                    std::uint64_t seed)
+{
+    int ld = static_cast<int>(trans == CblasNoTrans ? k : n);
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.random(n * k);
+    ops->b = builder.random(n * k);
+    ops->c = builder.random(n * n);
+
+    return builder.build([ops, n, k, uplo, trans, ld]() {
+        T alpha = static_cast<T>(1.0);
+        T beta = static_cast<T>(0.0);
+        BlasWrapper<T>::syr2k(CblasRowMajor, uplo, trans, n, k, alpha, ops->a.data(), ld,
+                              ops->b.data(), ld, beta, ops->c.data(), static_cast<int>(n));
+    });
+}
+
+namespace
+{
+
+template<typename T, bool Solve>
+BenchmarkFixture make_triangular_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                         CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, std::uint64_t seed)
+{
+    std::size_t order = side == CblasLeft ? m : n;
+
+    OperandBuilder<T> builder(seed);
+    auto ops = std::make_shared<OperandSet<T>>();
+    ops->a = builder.diagonally_dominant(order);
+    ops->b = builder.random(m * n);
+    ops->c = ops->b; // Pristine B, not touched by the kernel
+
+    auto reset = [ops]() { std::copy(ops->c.begin(), ops->c.end(), ops->b.begin()); };
+    return builder.build([ops, m, n, side, uplo, trans, diag, order]() {
+        T alpha = static_cast<T>(1.0);
+        if constexpr (Solve)
         {
-            utils::flush_cache(cache_size);
+            BlasWrapper<T>::trsm(CblasRowMajor, side, uplo, trans, diag, m, n, alpha,
+                                 ops->a.data(), static_cast<int>(order), ops->b.data(), static_cast<int>(n));
         }
-        BlasWrapper<T>::gemv(CblasRowMajor, CblasNoTrans, m, n, alpha, a.data(), 
-                             static_cast<int>(n), x.data(), 1, beta, y.data(), 1);
-    }
-    
-    // Benchmark runs
-    utils::Timer timer;
-    double total_time = 0.0;
-    
-    for (std::size_t i = 0; i < cycles; ++i)
-    {
-        if (flush_cache)
+        else
         {
-            utils::flush_cache(cache_size);
+            BlasWrapper<T>::trmm(CblasRowMajor, side, uplo, trans, diag, m, n, alpha,
+                                 ops->a.data(), static_cast<int>(order), ops->b.data(), static_cast<int>(n));
         }
-        
-        timer.start();
-        BlasWrapper<T>::gemv(CblasRowMajor, CblasNoTrans, m, n, alpha, a.data(),
-                             static_cast<int>(n), x.data(), 1, beta, y.data(), 1);
-        timer.stop();
-        
-        total_time += timer.elapsed_ms();
-    }
-    
-    return total_time / static_cast<double>(cycles);
+    }, reset, triangular_refresh_interval);
+}
+
+} // anonymous namespace
+
+template<typename T>
+BenchmarkFixture make_trmm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, std::uint64_t seed)
+{
+    return make_triangular_fixture<T, false>(m, n, side, uplo, trans, diag, seed);
 }
 
 template<typename T>
-double benchmark_gemm(std::size_t m, std::size_t n, std::size_t k, 
-                      std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size)
-{
-    auto a = generate_random_data<T>(m * k);
-    auto b = generate_random_data<T>(k * n);
-    auto c = generate_random_data<T>(m * n);
-    T alpha = static_cast<T>(1.0);
-    T beta = static_cast<T>(0.0);
-    
-    spdlog::debug("Benchmarking GEMM: M={}, N={}, K={}", m, n, k);
-    
-    // Warmup runs
-    for (std::size_t i = 0; i < warmup; ++i)
+BenchmarkFixture make_trsm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, std::uint64_t seed)
+{
+    return make_triangular_fixture<T, true>(m, n, side, uplo, trans, diag, seed);
+}
+
+// BLAS mode letters
+
+namespace
+{
+
+char mode_letter(const std::string& name, const char* kind)
+{
+    if (name.size() != 1)
     {
-        if (flush_cache)
-        {
-            utils::flush_cache(cache_size);
-        }
-        BlasWrapper<T>::gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                             m, n, k, alpha, a.data(), static_cast<int>(k),
-                             b.data(), static_cast<int>(n), beta, c.data(), static_cast<int>(n));
+        throw std::invalid_argument(std::string("Invalid ") + kind + " '" + name + "'");
     }
-    
-    // Benchmark runs
-    utils::Timer timer;
-    double total_time = 0.0;
-    
-    for (std::size_t i = 0; i < cycles; ++i)
+    return static_cast<char>(std::toupper(static_cast<unsigned char>(name[0])));
+}
+
+} // anonymous namespace
+
+CBLAS_ORDER parse_order(const std::string& name)
+{
+    switch (mode_letter(name, "order"))
     {
-        if (flush_cache)
-        {
-            utils::flush_cache(cache_size);
-        }
-        
-        timer.start();
-        BlasWrapper<T>::gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                             m, n, k, alpha, a.data(), static_cast<int>(k),
-                             b.data(), static_cast<int>(n), beta, c.data(), static_cast<int>(n));
-        timer.stop();
-        
-        total_time += timer.elapsed_ms();
-        spdlog::debug("Iteration {}: {} ms", i, timer.elapsed_ms());
+    case 'R':
+        return CblasRowMajor;
+    case 'C':
+        return CblasColMajor;
+    default:
+        throw std::invalid_argument("Invalid order '" + name + "' (expected R or C)");
+    }
+}
+
+CBLAS_SIDE parse_side(const std::string& name)
+{
+    switch (mode_letter(name, "side"))
+    {
+    case 'L':
+        return CblasLeft;
+    case 'R':
+        return CblasRight;
+    default:
+        throw std::invalid_argument("Invalid side '" + name + "' (expected L or R)");
+    }
+}
+
+CBLAS_UPLO parse_uplo(const std::string& name)
+{
+    switch (mode_letter(name, "uplo"))
+    {
+    case 'U':
+        return CblasUpper;
+    case 'L':
+        return CblasLower;
+    default:
+        throw std::invalid_argument("Invalid uplo '" + name + "' (expected U or L)");
+    }
+}
+
+CBLAS_TRANSPOSE parse_transpose(const std::string& name)
+{
+    switch (mode_letter(name, "trans"))
+    {
+    case 'N':
+        return CblasNoTrans;
+    case 'T':
+        return CblasTrans;
+    case 'C':
+        return CblasConjTrans;
+    default:
+        throw std::invalid_argument("Invalid trans '" + name + "' (expected N, T or C)");
+    }
+}
+
+CBLAS_DIAG parse_diag(const std::string& name)
+{
+    switch (mode_letter(name, "diag"))
+    {
+    case 'N':
+        return CblasNonUnit;
+    case 'U':
+        return CblasUnit;
+    default:
+        throw std::invalid_argument("Invalid diag '" + name + "' (expected N or U)");
     }
-    
-    return total_time / static_cast<double>(cycles);
 }
 
 // Explicit template instantiation for double precision
-template double benchmark_dot<double>(std::size_t n, std::size_t warmup, std::size_t cycles,
-                                       bool flush_cache, std::size_t cache_size);
-template double benchmark_axpy<double>(std::size_t n, std::size_t warmup, std::size_t cycles,
-                                        bool flush_cache, std::size_t cache_size);
-template double benchmark_scal<double>(std::size_t n, std::size_t warmup, std::size_t cycles,
-                                        bool flush_cache, std::size_t cache_size);
-template double benchmark_gemv<double>(std::size_t m, std::size_t n, std::size_t warmup, std::size_t cycles,
-                                        bool flush_cache, std::size_t cache_size);
-template double benchmark_gemm<double>(std::size_t m, std::size_t n, std::size_t k,
-                                        std::size_t warmup, std::size_t cycles,
-                                        bool flush_cache, std::size_t cache_size);
+template BenchmarkFixture make_dot_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_axpy_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_scal_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_nrm2_fixture<double>(std::size_t n, bool large_magnitude, std::uint64_t seed);
+template BenchmarkFixture make_asum_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_iamax_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_copy_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_swap_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_rot_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_rotm_fixture<double>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_gemv_fixture<double>(std::size_t m, std::size_t n, CBLAS_ORDER order,
+                                                    CBLAS_TRANSPOSE trans, std::size_t ld_padding,
+                                                    std::uint64_t seed);
+template BenchmarkFixture make_ger_fixture<double>(std::size_t m, std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_symv_fixture<double>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_trmv_fixture<double>(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                                    CBLAS_DIAG diag, std::uint64_t seed);
+template BenchmarkFixture make_trsv_fixture<double>(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                                    CBLAS_DIAG diag, std::uint64_t seed);
+template BenchmarkFixture make_syr_fixture<double>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_syr2_fixture<double>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_gbmv_fixture<double>(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku,
+                                                    CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_sbmv_fixture<double>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                    std::uint64_t seed);
+template BenchmarkFixture make_gemm_fixture<double>(std::size_t m, std::size_t n, std::size_t k,
+                                                    CBLAS_ORDER order, CBLAS_TRANSPOSE trans_a,
+                                                    CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                                    std::uint64_t seed);
+template BenchmarkFixture make_symm_fixture<double>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                    CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_syrk_fixture<double>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                    CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_syr2k_fixture<double>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                     CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_trmm_fixture<double>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                    CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                                    std::uint64_t seed);
+template BenchmarkFixture make_trsm_fixture<double>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                    CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                                    std::uint64_t seed);
+
+// Explicit template instantiation for single precision
+template BenchmarkFixture make_dot_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_axpy_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_scal_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_nrm2_fixture<float>(std::size_t n, bool large_magnitude, std::uint64_t seed);
+template BenchmarkFixture make_asum_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_iamax_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_copy_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_swap_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_rot_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_rotm_fixture<float>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_gemv_fixture<float>(std::size_t m, std::size_t n, CBLAS_ORDER order,
+                                                   CBLAS_TRANSPOSE trans, std::size_t ld_padding,
+                                                   std::uint64_t seed);
+template BenchmarkFixture make_ger_fixture<float>(std::size_t m, std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_symv_fixture<float>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_trmv_fixture<float>(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                                   CBLAS_DIAG diag, std::uint64_t seed);
+template BenchmarkFixture make_trsv_fixture<float>(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                                   CBLAS_DIAG diag, std::uint64_t seed);
+template BenchmarkFixture make_syr_fixture<float>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_syr2_fixture<float>(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_gbmv_fixture<float>(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku,
+                                                   CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_sbmv_fixture<float>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                   std::uint64_t seed);
+template BenchmarkFixture make_gemm_fixture<float>(std::size_t m, std::size_t n, std::size_t k,
+                                                   CBLAS_ORDER order, CBLAS_TRANSPOSE trans_a,
+                                                   CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                                   std::uint64_t seed);
+template BenchmarkFixture make_symm_fixture<float>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                   CBLAS_UPLO uplo, std::uint64_t seed);
+template BenchmarkFixture make_syrk_fixture<float>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                   CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_syr2k_fixture<float>(std::size_t n, std::size_t k, CBLAS_UPLO uplo,
+                                                    CBLAS_TRANSPOSE trans, std::uint64_t seed);
+template BenchmarkFixture make_trmm_fixture<float>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                   CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                                   std::uint64_t seed);
+template BenchmarkFixture make_trsm_fixture<float>(std::size_t m, std::size_t n, CBLAS_SIDE side,
+                                                   CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                                   std::uint64_t seed);
+
+// Explicit template instantiation for complex precisions
+template BenchmarkFixture make_dot_fixture<std::complex<float>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_dotc_fixture<std::complex<float>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_axpy_fixture<std::complex<float>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_scal_fixture<std::complex<float>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_gemv_fixture<std::complex<float>>(std::size_t m, std::size_t n, CBLAS_ORDER order,
+                                                                 CBLAS_TRANSPOSE trans, std::size_t ld_padding,
+                                                                 std::uint64_t seed);
+template BenchmarkFixture make_gemm_fixture<std::complex<float>>(std::size_t m, std::size_t n, std::size_t k,
+                                                                 CBLAS_ORDER order, CBLAS_TRANSPOSE trans_a,
+                                                                 CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                                                 std::uint64_t seed);
+
+template BenchmarkFixture make_dot_fixture<std::complex<double>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_dotc_fixture<std::complex<double>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_axpy_fixture<std::complex<double>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_scal_fixture<std::complex<double>>(std::size_t n, std::uint64_t seed);
+template BenchmarkFixture make_gemv_fixture<std::complex<double>>(std::size_t m, std::size_t n, CBLAS_ORDER order,
+                                                                  CBLAS_TRANSPOSE trans, std::size_t ld_padding,
+                                                                  std::uint64_t seed);
+template BenchmarkFixture make_gemm_fixture<std::complex<double>>(std::size_t m, std::size_t n, std::size_t k,
+                                                                  CBLAS_ORDER order, CBLAS_TRANSPOSE trans_a,
+                                                                  CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                                                  std::uint64_t seed);
 
 } // namespace blas_benchmark
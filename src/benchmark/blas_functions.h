@@ -1,20 +1,28 @@
 #pragma once
 
+#include <algorithm>
+#include <complex>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <cblas.h>
 
+#include "utils/cache_flusher.h"
+#include "utils/perf_counters.h"
+#include "utils/random.h"
+#include "utils/timer.h"
+
 namespace blas_benchmark
 {
 
 // Precision type traits for BLAS functions
-// This design allows future extension to single precision and other types
+// One specialization per BLAS prefix: s, d, c and z
 template<typename T>
 struct BlasPrecisionTraits;
 
@@ -22,6 +30,8 @@ template<>
 struct BlasPrecisionTraits<double>
 {
     using value_type = double;
+    using real_type = double;
+    static constexpr bool is_complex = false;
     static constexpr char precision_char = 'd';
     static constexpr const char* name = "double";
 };
@@ -30,50 +40,456 @@ template<>
 struct BlasPrecisionTraits<float>
 {
     using value_type = float;
+    using real_type = float;
+    static constexpr bool is_complex = false;
     static constexpr char precision_char = 's';
     static constexpr const char* name = "float";
 };
 
+template<>
+struct BlasPrecisionTraits<std::complex<float>>
+{
+    using value_type = std::complex<float>;
+    using real_type = float;
+    static constexpr bool is_complex = true;
+    static constexpr char precision_char = 'c';
+    static constexpr const char* name = "complex<float>";
+};
+
+template<>
+struct BlasPrecisionTraits<std::complex<double>>
+{
+    using value_type = std::complex<double>;
+    using real_type = double;
+    static constexpr bool is_complex = true;
+    static constexpr char precision_char = 'z';
+    static constexpr const char* name = "complex<double>";
+};
+
 // FLOPS calculation functions for each BLAS operation
+// Counts are real FLOPs for element type T: a complex multiply weighs 6
+// (4 multiplications + 2 additions) and a complex addition 2, so complex
+// GFLOPS are directly comparable to the real kernels
 namespace flops
 {
 
+// Real FLOPs of `multiplies` multiplications and `adds` additions of type T
+template<typename T = double>
+constexpr std::size_t weighted(std::size_t multiplies, std::size_t adds)
+{
+    if constexpr (BlasPrecisionTraits<T>::is_complex)
+    {
+        return 6 * multiplies + 2 * adds;
+    }
+    else
+    {
+        return multiplies + adds;
+    }
+}
+
 // Level 1 operations
-// ddot: n multiplications + (n-1) additions ≈ 2n FLOPs
+// ddot: n multiplications + (n-1) additions ≈ 2n FLOPs (8n complex)
+template<typename T = double>
 constexpr std::size_t dot(std::size_t n)
 {
-    return 2 * n;
+    return weighted<T>(n, n);
 }
 
-// daxpy: n multiplications + n additions = 2n FLOPs
+// daxpy: n multiplications + n additions = 2n FLOPs (8n complex)
+template<typename T = double>
 constexpr std::size_t axpy(std::size_t n)
 {
-    return 2 * n;
+    return weighted<T>(n, n);
 }
 
-// dscal: n multiplications = n FLOPs
+// dscal: n multiplications = n FLOPs (6n complex)
+template<typename T = double>
 constexpr std::size_t scal(std::size_t n)
 {
-    return n;
+    return weighted<T>(n, 0);
+}
+
+// dnrm2: n multiplications + n additions (the final square root is ignored) = 2n FLOPs
+template<typename T = double>
+constexpr std::size_t nrm2(std::size_t n)
+{
+    return weighted<T>(n, n);
+}
+
+// dasum: n additions of |x_i| = n FLOPs
+template<typename T = double>
+constexpr std::size_t asum(std::size_t n)
+{
+    return weighted<T>(0, n);
+}
+
+// idamax: n magnitude comparisons, counted as one FLOP each = n FLOPs
+template<typename T = double>
+constexpr std::size_t iamax(std::size_t n)
+{
+    return weighted<T>(0, n);
+}
+
+// dcopy / dswap: pure data movement, 0 FLOPs (judge them by GB/s)
+template<typename T = double>
+constexpr std::size_t copy(std::size_t /*n*/)
+{
+    return 0;
+}
+
+template<typename T = double>
+constexpr std::size_t swap(std::size_t /*n*/)
+{
+    return 0;
+}
+
+// drot: x' = c*x + s*y, y' = c*y - s*x, 4 multiplications + 2 additions per pair = 6n FLOPs
+template<typename T = double>
+constexpr std::size_t rot(std::size_t n)
+{
+    return weighted<T>(4 * n, 2 * n);
+}
+
+// drotm with a full H (flag = -1): same arithmetic as drot = 6n FLOPs
+template<typename T = double>
+constexpr std::size_t rotm(std::size_t n)
+{
+    return weighted<T>(4 * n, 2 * n);
 }
 
 // Level 2 operations
-// dgemv: m*n multiplications + m*(n-1) additions ≈ 2mn FLOPs
+// dgemv: m*n multiplications + m*(n-1) additions ≈ 2mn FLOPs (8mn complex)
+template<typename T = double>
 constexpr std::size_t gemv(std::size_t m, std::size_t n)
 {
-    return 2 * m * n;
+    return weighted<T>(m * n, m * n);
+}
+
+// Entries of an m x n band matrix with kl sub- and ku super-diagonals
+constexpr std::size_t band_entries(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku)
+{
+    std::size_t entries = 0;
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t first = i > kl ? i - kl : 0;
+        std::size_t last = std::min(n, i + ku + 1);
+        entries += last > first ? last - first : 0;
+    }
+    return entries;
+}
+
+// dger: A += alpha * x * y^T, one multiply-add per entry plus alpha * x = 2mn FLOPs
+template<typename T = double>
+constexpr std::size_t ger(std::size_t m, std::size_t n)
+{
+    return weighted<T>(m * n, m * n);
+}
+
+// dsymv: full n x n matrix-vector product from one stored triangle = 2n^2 FLOPs
+template<typename T = double>
+constexpr std::size_t symv(std::size_t n)
+{
+    return weighted<T>(n * n, n * n);
+}
+
+// dtrmv: n(n+1)/2 multiplications + n(n-1)/2 additions = n^2 FLOPs
+template<typename T = double>
+constexpr std::size_t trmv(std::size_t n)
+{
+    return weighted<T>(n * (n + 1) / 2, n * (n - 1) / 2);
+}
+
+// dtrsv: same count as dtrmv (the n divisions are counted as multiplications)
+template<typename T = double>
+constexpr std::size_t trsv(std::size_t n)
+{
+    return trmv<T>(n);
+}
+
+// dsyr: one triangle of A += alpha * x * x^T, a multiply-add per entry = n(n+1) FLOPs
+template<typename T = double>
+constexpr std::size_t syr(std::size_t n)
+{
+    return weighted<T>(n * (n + 1) / 2, n * (n + 1) / 2);
+}
+
+// dsyr2: one triangle of A += alpha * (x * y^T + y * x^T), two multiply-adds per entry = 2n(n+1) FLOPs
+template<typename T = double>
+constexpr std::size_t syr2(std::size_t n)
+{
+    return weighted<T>(n * (n + 1), n * (n + 1));
+}
+
+// dgbmv: a multiply-add per stored band entry
+template<typename T = double>
+constexpr std::size_t gbmv(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku)
+{
+    std::size_t entries = band_entries(m, n, kl, ku);
+    return weighted<T>(entries, entries);
+}
+
+// dsbmv: a multiply-add per entry of the full symmetric band (half-bandwidth k)
+template<typename T = double>
+constexpr std::size_t sbmv(std::size_t n, std::size_t k)
+{
+    std::size_t entries = band_entries(n, n, k, k);
+    return weighted<T>(entries, entries);
 }
 
 // Level 3 operations
-// dgemm: m*n*k multiplications + m*n*(k-1) additions ≈ 2mnk FLOPs
+// dgemm: m*n*k multiplications + m*n*(k-1) additions ≈ 2mnk FLOPs (8mnk complex)
+template<typename T = double>
 constexpr std::size_t gemm(std::size_t m, std::size_t n, std::size_t k)
 {
-    return 2 * m * n * k;
+    return weighted<T>(m * n * k, m * n * k);
+}
+
+// dsymm: A symmetric (m x m on the left, n x n on the right) times B (m x n)
+// 2m^2n (left) or 2mn^2 (right) FLOPs
+template<typename T = double>
+constexpr std::size_t symm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    std::size_t order = side == CblasLeft ? m : n;
+    return weighted<T>(order * m * n, order * m * n);
+}
+
+// dsyrk: one triangle of C (n x n) = A (n x k) * A^T, 2k per entry = kn(n+1) FLOPs
+template<typename T = double>
+constexpr std::size_t syrk(std::size_t n, std::size_t k)
+{
+    return weighted<T>(k * n * (n + 1) / 2, k * n * (n + 1) / 2);
+}
+
+// dsyr2k: one triangle of C = A * B^T + B * A^T, 4k per entry = 2kn(n+1) FLOPs
+template<typename T = double>
+constexpr std::size_t syr2k(std::size_t n, std::size_t k)
+{
+    return weighted<T>(k * n * (n + 1), k * n * (n + 1));
+}
+
+// dtrmm: triangular A (order = m on the left, n on the right) times B (m x n)
+// Per column of B, order(order+1)/2 multiplications + order(order-1)/2 additions:
+// m^2n (left) or mn^2 (right) FLOPs
+template<typename T = double>
+constexpr std::size_t trmm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    std::size_t order = side == CblasLeft ? m : n;
+    std::size_t vectors = side == CblasLeft ? n : m;
+    return weighted<T>(vectors * order * (order + 1) / 2, vectors * order * (order - 1) / 2);
+}
+
+// dtrsm: triangular solve with m x n right-hand sides, same count as dtrmm
+// (the order divisions are counted as multiplications)
+template<typename T = double>
+constexpr std::size_t trsm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    return trmm<T>(m, n, side);
 }
 
 } // namespace flops
 
+// Memory traffic of one call, split into bytes read and bytes written
+struct Traffic
+{
+    std::size_t read{0};
+    std::size_t written{0};
+
+    [[nodiscard]] constexpr std::size_t total() const
+    {
+        return read + written;
+    }
+};
+
+// Compulsory memory traffic per call for element type T: every input element
+// read once and every output element written once (no capacity misses, no
+// write-allocate); scalar results and arguments are ignored
+namespace bytes
+{
+
+// Level 1 operations
+// ddot: read x and y
+template<typename T = double>
+constexpr Traffic dot(std::size_t n)
+{
+    return {2 * n * sizeof(T), 0};
+}
+
+// daxpy: read x and y, write y
+template<typename T = double>
+constexpr Traffic axpy(std::size_t n)
+{
+    return {2 * n * sizeof(T), n * sizeof(T)};
+}
+
+// dscal: read and write x
+template<typename T = double>
+constexpr Traffic scal(std::size_t n)
+{
+    return {n * sizeof(T), n * sizeof(T)};
+}
+
+// dnrm2 / dasum / idamax: read x
+template<typename T = double>
+constexpr Traffic nrm2(std::size_t n)
+{
+    return {n * sizeof(T), 0};
+}
+
+template<typename T = double>
+constexpr Traffic asum(std::size_t n)
+{
+    return {n * sizeof(T), 0};
+}
+
+template<typename T = double>
+constexpr Traffic iamax(std::size_t n)
+{
+    return {n * sizeof(T), 0};
+}
+
+// dcopy: read x, write y
+template<typename T = double>
+constexpr Traffic copy(std::size_t n)
+{
+    return {n * sizeof(T), n * sizeof(T)};
+}
+
+// dswap / drot / drotm: read and write both x and y
+template<typename T = double>
+constexpr Traffic swap(std::size_t n)
+{
+    return {2 * n * sizeof(T), 2 * n * sizeof(T)};
+}
+
+template<typename T = double>
+constexpr Traffic rot(std::size_t n)
+{
+    return {2 * n * sizeof(T), 2 * n * sizeof(T)};
+}
+
+template<typename T = double>
+constexpr Traffic rotm(std::size_t n)
+{
+    return {2 * n * sizeof(T), 2 * n * sizeof(T)};
+}
+
+// Level 2 operations
+// dgemv (beta = 0): read A (m x n) and x (n), write y (m); lengths swap when transposed
+// Leading-dimension padding is never read, so it does not count
+template<typename T = double>
+constexpr Traffic gemv(std::size_t m, std::size_t n, CBLAS_TRANSPOSE trans = CblasNoTrans)
+{
+    std::size_t x_len = trans == CblasNoTrans ? n : m;
+    std::size_t y_len = trans == CblasNoTrans ? m : n;
+    return {(m * n + x_len) * sizeof(T), y_len * sizeof(T)};
+}
+
+// dger: read x (m), y (n) and A (m x n), write A
+template<typename T = double>
+constexpr Traffic ger(std::size_t m, std::size_t n)
+{
+    return {(m * n + m + n) * sizeof(T), m * n * sizeof(T)};
+}
+
+// dsymv (beta = 0): read one triangle of A and x, write y
+template<typename T = double>
+constexpr Traffic symv(std::size_t n)
+{
+    return {(n * (n + 1) / 2 + n) * sizeof(T), n * sizeof(T)};
+}
+
+// dtrmv / dtrsv: read one triangle of A and x, overwrite x in place
+template<typename T = double>
+constexpr Traffic trmv(std::size_t n)
+{
+    return {(n * (n + 1) / 2 + n) * sizeof(T), n * sizeof(T)};
+}
+
+template<typename T = double>
+constexpr Traffic trsv(std::size_t n)
+{
+    return trmv<T>(n);
+}
+
+// dsyr: read x and one triangle of A, write that triangle
+template<typename T = double>
+constexpr Traffic syr(std::size_t n)
+{
+    return {(n * (n + 1) / 2 + n) * sizeof(T), n * (n + 1) / 2 * sizeof(T)};
+}
+
+// dsyr2: read x, y and one triangle of A, write that triangle
+template<typename T = double>
+constexpr Traffic syr2(std::size_t n)
+{
+    return {(n * (n + 1) / 2 + 2 * n) * sizeof(T), n * (n + 1) / 2 * sizeof(T)};
+}
+
+// dgbmv (beta = 0): read the band entries and x, write y (lengths swap when transposed)
+template<typename T = double>
+constexpr Traffic gbmv(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku, CBLAS_TRANSPOSE trans)
+{
+    std::size_t x_len = trans == CblasNoTrans ? n : m;
+    std::size_t y_len = trans == CblasNoTrans ? m : n;
+    return {(flops::band_entries(m, n, kl, ku) + x_len) * sizeof(T), y_len * sizeof(T)};
+}
+
+// dsbmv (beta = 0): read the stored triangle of the band and x, write y
+template<typename T = double>
+constexpr Traffic sbmv(std::size_t n, std::size_t k)
+{
+    return {(flops::band_entries(n, n, 0, k) + n) * sizeof(T), n * sizeof(T)};
+}
+
+// Level 3 operations
+// dgemm (beta = 0): read A (m x k) and B (k x n), write C (m x n)
+template<typename T = double>
+constexpr Traffic gemm(std::size_t m, std::size_t n, std::size_t k)
+{
+    return {(m * k + k * n) * sizeof(T), m * n * sizeof(T)};
+}
+
+// dsymm (beta = 0): read one triangle of A and B (m x n), write C (m x n)
+template<typename T = double>
+constexpr Traffic symm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    std::size_t order = side == CblasLeft ? m : n;
+    return {(order * (order + 1) / 2 + m * n) * sizeof(T), m * n * sizeof(T)};
+}
+
+// dsyrk (beta = 0): read A (n x k), write one triangle of C
+template<typename T = double>
+constexpr Traffic syrk(std::size_t n, std::size_t k)
+{
+    return {n * k * sizeof(T), n * (n + 1) / 2 * sizeof(T)};
+}
+
+// dsyr2k (beta = 0): read A and B (n x k each), write one triangle of C
+template<typename T = double>
+constexpr Traffic syr2k(std::size_t n, std::size_t k)
+{
+    return {2 * n * k * sizeof(T), n * (n + 1) / 2 * sizeof(T)};
+}
+
+// dtrmm / dtrsm: read one triangle of A and B (m x n), overwrite B in place
+template<typename T = double>
+constexpr Traffic trmm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    std::size_t order = side == CblasLeft ? m : n;
+    return {(order * (order + 1) / 2 + m * n) * sizeof(T), m * n * sizeof(T)};
+}
+
+template<typename T = double>
+constexpr Traffic trsm(std::size_t m, std::size_t n, CBLAS_SIDE side)
+{
+    return trmm<T>(m, n, side);
+}
+
+} // namespace bytes
+
 // BLAS function wrapper with template support for precision
+// Complex entry points take alpha/beta by pointer and return dot products
+// through the `_sub` variants, as the CBLAS interface requires
 template<typename T = double>
 class BlasWrapper
 {
@@ -82,17 +498,51 @@ public:
 
     // Level 1: Vector-vector operations
 
-    // Dot product: result = x^T * y
+    // Dot product: result = x^T * y (cblas_?dotu_sub for complex)
     static T dot(std::size_t n, const T* x, int incx, const T* y, int incy)
     {
         if constexpr (std::is_same_v<T, double>)
         {
             return cblas_ddot(static_cast<int>(n), x, incx, y, incy);
         }
-        else
+        else if constexpr (std::is_same_v<T, float>)
         {
             return cblas_sdot(static_cast<int>(n), x, incx, y, incy);
         }
+        else
+        {
+            T result{};
+            if constexpr (std::is_same_v<T, std::complex<double>>)
+            {
+                cblas_zdotu_sub(static_cast<int>(n), x, incx, y, incy, &result);
+            }
+            else
+            {
+                cblas_cdotu_sub(static_cast<int>(n), x, incx, y, incy, &result);
+            }
+            return result;
+        }
+    }
+
+    // Conjugated dot product: result = x^H * y (same as dot for real types)
+    static T dotc(std::size_t n, const T* x, int incx, const T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            T result{};
+            cblas_zdotc_sub(static_cast<int>(n), x, incx, y, incy, &result);
+            return result;
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        {
+            T result{};
+            cblas_cdotc_sub(static_cast<int>(n), x, incx, y, incy, &result);
+            return result;
+        }
+        else
+        {
+            return dot(n, x, incx, y, incy);
+        }
     }
 
     // AXPY: y = alpha * x + y
@@ -102,10 +552,18 @@ public:
         {
             cblas_daxpy(static_cast<int>(n), alpha, x, incx, y, incy);
         }
-        else
+        else if constexpr (std::is_same_v<T, float>)
         {
             cblas_saxpy(static_cast<int>(n), alpha, x, incx, y, incy);
         }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            cblas_zaxpy(static_cast<int>(n), &alpha, x, incx, y, incy);
+        }
+        else
+        {
+            cblas_caxpy(static_cast<int>(n), &alpha, x, incx, y, incy);
+        }
     }
 
     // SCAL: x = alpha * x
@@ -115,33 +573,277 @@ public:
         {
             cblas_dscal(static_cast<int>(n), alpha, x, incx);
         }
-        else
+        else if constexpr (std::is_same_v<T, float>)
         {
             cblas_sscal(static_cast<int>(n), alpha, x, incx);
         }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            cblas_zscal(static_cast<int>(n), &alpha, x, incx);
+        }
+        else
+        {
+            cblas_cscal(static_cast<int>(n), &alpha, x, incx);
+        }
     }
 
-    // Level 2: Matrix-vector operations
+    // Norms, reductions, copies and rotations (real types only)
 
-    // GEMV: y = alpha * A * x + beta * y
-    static void gemv(CBLAS_ORDER order, CBLAS_TRANSPOSE trans,
-                     std::size_t m, std::size_t n,
-                     T alpha, const T* a, int lda,
-                     const T* x, int incx,
-                     T beta, T* y, int incy)
+    // NRM2: result = ||x||_2, computed without intermediate overflow
+    static T nrm2(std::size_t n, const T* x, int incx)
     {
         if constexpr (std::is_same_v<T, double>)
         {
-            cblas_dgemv(order, trans,
-                        static_cast<int>(m), static_cast<int>(n),
-                        alpha, a, lda, x, incx, beta, y, incy);
+            return cblas_dnrm2(static_cast<int>(n), x, incx);
         }
         else
         {
-            cblas_sgemv(order, trans,
+            return cblas_snrm2(static_cast<int>(n), x, incx);
+        }
+    }
+
+    // ASUM: result = sum |x_i|
+    static T asum(std::size_t n, const T* x, int incx)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            return cblas_dasum(static_cast<int>(n), x, incx);
+        }
+        else
+        {
+            return cblas_sasum(static_cast<int>(n), x, incx);
+        }
+    }
+
+    // IAMAX: index of the first element with the largest |x_i|
+    static std::size_t iamax(std::size_t n, const T* x, int incx)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            return cblas_idamax(static_cast<int>(n), x, incx);
+        }
+        else
+        {
+            return cblas_isamax(static_cast<int>(n), x, incx);
+        }
+    }
+
+    // COPY: y = x
+    static void copy(std::size_t n, const T* x, int incx, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dcopy(static_cast<int>(n), x, incx, y, incy);
+        }
+        else
+        {
+            cblas_scopy(static_cast<int>(n), x, incx, y, incy);
+        }
+    }
+
+    // SWAP: x <-> y
+    static void swap(std::size_t n, T* x, int incx, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dswap(static_cast<int>(n), x, incx, y, incy);
+        }
+        else
+        {
+            cblas_sswap(static_cast<int>(n), x, incx, y, incy);
+        }
+    }
+
+    // ROT: apply the plane rotation (c, s) to the pairs (x_i, y_i)
+    static void rot(std::size_t n, T* x, int incx, T* y, int incy, T c, T s)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_drot(static_cast<int>(n), x, incx, y, incy, c, s);
+        }
+        else
+        {
+            cblas_srot(static_cast<int>(n), x, incx, y, incy, c, s);
+        }
+    }
+
+    // ROTM: apply the modified Givens transformation H given by param[5] (flag, h11, h21, h12, h22)
+    static void rotm(std::size_t n, T* x, int incx, T* y, int incy, const T* param)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_drotm(static_cast<int>(n), x, incx, y, incy, param);
+        }
+        else
+        {
+            cblas_srotm(static_cast<int>(n), x, incx, y, incy, param);
+        }
+    }
+
+    // Level 2: Matrix-vector operations
+
+    // GEMV: y = alpha * A * x + beta * y
+    static void gemv(CBLAS_ORDER order, CBLAS_TRANSPOSE trans,
+                     std::size_t m, std::size_t n,
+                     T alpha, const T* a, int lda,
+                     const T* x, int incx,
+                     T beta, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dgemv(order, trans,
                         static_cast<int>(m), static_cast<int>(n),
                         alpha, a, lda, x, incx, beta, y, incy);
         }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            cblas_sgemv(order, trans,
+                        static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, x, incx, beta, y, incy);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            cblas_zgemv(order, trans,
+                        static_cast<int>(m), static_cast<int>(n),
+                        &alpha, a, lda, x, incx, &beta, y, incy);
+        }
+        else
+        {
+            cblas_cgemv(order, trans,
+                        static_cast<int>(m), static_cast<int>(n),
+                        &alpha, a, lda, x, incx, &beta, y, incy);
+        }
+    }
+
+    // Symmetric, triangular, banded and update Level 2 operations (real types only)
+
+    // GER: A = alpha * x * y^T + A
+    static void ger(CBLAS_ORDER order, std::size_t m, std::size_t n,
+                    T alpha, const T* x, int incx,
+                    const T* y, int incy,
+                    T* a, int lda)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dger(order, static_cast<int>(m), static_cast<int>(n), alpha, x, incx, y, incy, a, lda);
+        }
+        else
+        {
+            cblas_sger(order, static_cast<int>(m), static_cast<int>(n), alpha, x, incx, y, incy, a, lda);
+        }
+    }
+
+    // SYMV: y = alpha * A * x + beta * y, A symmetric
+    static void symv(CBLAS_ORDER order, CBLAS_UPLO uplo, std::size_t n,
+                     T alpha, const T* a, int lda,
+                     const T* x, int incx,
+                     T beta, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsymv(order, uplo, static_cast<int>(n), alpha, a, lda, x, incx, beta, y, incy);
+        }
+        else
+        {
+            cblas_ssymv(order, uplo, static_cast<int>(n), alpha, a, lda, x, incx, beta, y, incy);
+        }
+    }
+
+    // TRMV: x = op(A) * x, A triangular
+    static void trmv(CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                     std::size_t n, const T* a, int lda, T* x, int incx)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dtrmv(order, uplo, trans, diag, static_cast<int>(n), a, lda, x, incx);
+        }
+        else
+        {
+            cblas_strmv(order, uplo, trans, diag, static_cast<int>(n), a, lda, x, incx);
+        }
+    }
+
+    // TRSV: solve op(A) * x = b, x overwrites b
+    static void trsv(CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                     std::size_t n, const T* a, int lda, T* x, int incx)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dtrsv(order, uplo, trans, diag, static_cast<int>(n), a, lda, x, incx);
+        }
+        else
+        {
+            cblas_strsv(order, uplo, trans, diag, static_cast<int>(n), a, lda, x, incx);
+        }
+    }
+
+    // SYR: A = alpha * x * x^T + A, A symmetric
+    static void syr(CBLAS_ORDER order, CBLAS_UPLO uplo, std::size_t n,
+                    T alpha, const T* x, int incx, T* a, int lda)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsyr(order, uplo, static_cast<int>(n), alpha, x, incx, a, lda);
+        }
+        else
+        {
+            cblas_ssyr(order, uplo, static_cast<int>(n), alpha, x, incx, a, lda);
+        }
+    }
+
+    // SYR2: A = alpha * x * y^T + alpha * y * x^T + A, A symmetric
+    static void syr2(CBLAS_ORDER order, CBLAS_UPLO uplo, std::size_t n,
+                     T alpha, const T* x, int incx,
+                     const T* y, int incy,
+                     T* a, int lda)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsyr2(order, uplo, static_cast<int>(n), alpha, x, incx, y, incy, a, lda);
+        }
+        else
+        {
+            cblas_ssyr2(order, uplo, static_cast<int>(n), alpha, x, incx, y, incy, a, lda);
+        }
+    }
+
+    // GBMV: y = alpha * op(A) * x + beta * y, A banded with kl sub- and ku super-diagonals
+    static void gbmv(CBLAS_ORDER order, CBLAS_TRANSPOSE trans,
+                     std::size_t m, std::size_t n, std::size_t kl, std::size_t ku,
+                     T alpha, const T* a, int lda,
+                     const T* x, int incx,
+                     T beta, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dgbmv(order, trans, static_cast<int>(m), static_cast<int>(n),
+                        static_cast<int>(kl), static_cast<int>(ku),
+                        alpha, a, lda, x, incx, beta, y, incy);
+        }
+        else
+        {
+            cblas_sgbmv(order, trans, static_cast<int>(m), static_cast<int>(n),
+                        static_cast<int>(kl), static_cast<int>(ku),
+                        alpha, a, lda, x, incx, beta, y, incy);
+        }
+    }
+
+    // SBMV: y = alpha * A * x + beta * y, A symmetric banded with k super-diagonals
+    static void sbmv(CBLAS_ORDER order, CBLAS_UPLO uplo, std::size_t n, std::size_t k,
+                     T alpha, const T* a, int lda,
+                     const T* x, int incx,
+                     T beta, T* y, int incy)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsbmv(order, uplo, static_cast<int>(n), static_cast<int>(k),
+                        alpha, a, lda, x, incx, beta, y, incy);
+        }
+        else
+        {
+            cblas_ssbmv(order, uplo, static_cast<int>(n), static_cast<int>(k),
+                        alpha, a, lda, x, incx, beta, y, incy);
+        }
     }
 
     // Level 3: Matrix-matrix operations
@@ -159,50 +861,353 @@ public:
                         static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
                         alpha, a, lda, b, ldb, beta, c, ldc);
         }
-        else
+        else if constexpr (std::is_same_v<T, float>)
         {
             cblas_sgemm(order, trans_a, trans_b,
                         static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
                         alpha, a, lda, b, ldb, beta, c, ldc);
         }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            cblas_zgemm(order, trans_a, trans_b,
+                        static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
+                        &alpha, a, lda, b, ldb, &beta, c, ldc);
+        }
+        else
+        {
+            cblas_cgemm(order, trans_a, trans_b,
+                        static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
+                        &alpha, a, lda, b, ldb, &beta, c, ldc);
+        }
+    }
+
+    // Symmetric and triangular Level 3 operations (real types only)
+
+    // SYMM: C = alpha * A * B + beta * C (side = left) or alpha * B * A + beta * C, A symmetric
+    static void symm(CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                     std::size_t m, std::size_t n,
+                     T alpha, const T* a, int lda,
+                     const T* b, int ldb,
+                     T beta, T* c, int ldc)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsymm(order, side, uplo, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+        else
+        {
+            cblas_ssymm(order, side, uplo, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+    }
+
+    // SYRK: C = alpha * A * A^T + beta * C (trans = N) or alpha * A^T * A + beta * C
+    static void syrk(CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                     std::size_t n, std::size_t k,
+                     T alpha, const T* a, int lda,
+                     T beta, T* c, int ldc)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsyrk(order, uplo, trans, static_cast<int>(n), static_cast<int>(k),
+                        alpha, a, lda, beta, c, ldc);
+        }
+        else
+        {
+            cblas_ssyrk(order, uplo, trans, static_cast<int>(n), static_cast<int>(k),
+                        alpha, a, lda, beta, c, ldc);
+        }
+    }
+
+    // SYR2K: C = alpha * (A * B^T + B * A^T) + beta * C (trans = N)
+    static void syr2k(CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                      std::size_t n, std::size_t k,
+                      T alpha, const T* a, int lda,
+                      const T* b, int ldb,
+                      T beta, T* c, int ldc)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dsyr2k(order, uplo, trans, static_cast<int>(n), static_cast<int>(k),
+                         alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+        else
+        {
+            cblas_ssyr2k(order, uplo, trans, static_cast<int>(n), static_cast<int>(k),
+                         alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+    }
+
+    // TRMM: B = alpha * op(A) * B (side = left) or alpha * B * op(A), A triangular
+    static void trmm(CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                     CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                     std::size_t m, std::size_t n,
+                     T alpha, const T* a, int lda,
+                     T* b, int ldb)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dtrmm(order, side, uplo, trans, diag, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb);
+        }
+        else
+        {
+            cblas_strmm(order, side, uplo, trans, diag, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb);
+        }
+    }
+
+    // TRSM: solve op(A) * X = alpha * B (side = left) or X * op(A) = alpha * B, X overwrites B
+    static void trsm(CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                     CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                     std::size_t m, std::size_t n,
+                     T alpha, const T* a, int lda,
+                     T* b, int ldb)
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            cblas_dtrsm(order, side, uplo, trans, diag, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb);
+        }
+        else
+        {
+            cblas_strsm(order, side, uplo, trans, diag, static_cast<int>(m), static_cast<int>(n),
+                        alpha, a, lda, b, ldb);
+        }
     }
 };
 
 // Type alias for double precision (most common case)
 using DBlasWrapper = BlasWrapper<double>;
 using SBlasWrapper = BlasWrapper<float>;
+using CBlasWrapper = BlasWrapper<std::complex<float>>;
+using ZBlasWrapper = BlasWrapper<std::complex<double>>;
+
+// Operand storage: allocated without zero-filling, so the parallel random fill
+// touches every page first
+template<typename T>
+using OperandBuffer = std::vector<T, utils::UninitializedAllocator<T>>;
+
+// Operand buffers for a single benchmark
+// Allocated and initialized once, then shared by the warmup and every timed call
+template<typename T = double>
+struct OperandSet
+{
+    OperandBuffer<T> a;
+    OperandBuffer<T> b;
+    OperandBuffer<T> c;
+    OperandBuffer<T> x;
+    OperandBuffer<T> y;
+};
+
+// Benchmark fixture for one (function, size, precision) combination
+// Owns the operands through the kernel closure, so timed cycles only run the BLAS call
+class BenchmarkFixture
+{
+public:
+    using Kernel = std::function<void()>;
+
+    // Restores operands a kernel overwrites (e.g. the right-hand side of trsm); never timed
+    using Reset = std::function<void()>;
+
+    // With a reset, at most `reset_interval` calls run between two resets
+    BenchmarkFixture(Kernel kernel, double setup_time_ms, std::uint64_t operand_checksum,
+                     std::vector<utils::MemoryRegion> operands, Reset reset = {},
+                     std::size_t reset_interval = 1);
+
+    // Run warmup iterations, once per fixture
+    // The flusher (if any) prepares the cache state before each call
+    void warmup(std::size_t iterations, utils::CacheFlusher* flusher);
+
+    // Time `repetitions` back-to-back calls and return the time per call in milliseconds
+    // The reset (if any) and cache preparation (if any) happen before the timer starts,
+    // in that order, so a cold call also finds the restored operands cold; longer batches
+    // are timed in segments of reset_interval calls with untimed resets in between.
+    // `overhead_ns` (the cost of reading the timer) is subtracted per timed segment
+    // Hardware counters (if any) are enabled only around the timed segments
+    [[nodiscard]] double run(utils::CacheFlusher* flusher, std::size_t repetitions = 1, double overhead_ns = 0.0,
+                             utils::TimerSource source = utils::TimerSource::chrono,
+                             utils::PerfCounters* counters = nullptr);
+
+    // Time spent allocating and initializing operands
+    [[nodiscard]] double setup_time_ms() const
+    {
+        return m_setup_time_ms;
+    }
+
+    // Time spent in warmup iterations (including cache flushes)
+    [[nodiscard]] double warmup_time_ms() const
+    {
+        return m_warmup_time_ms;
+    }
+
+    // Checksum of the freshly initialized operands, to verify a rerun sees the same data
+    [[nodiscard]] std::uint64_t operand_checksum() const
+    {
+        return m_operand_checksum;
+    }
+
+    // Memory touched by the kernel, for targeted eviction or warming
+    [[nodiscard]] const std::vector<utils::MemoryRegion>& operands() const
+    {
+        return m_operands;
+    }
+
+private:
+    // Elapsed nanoseconds for a batch of back-to-back calls, timer overhead removed per
+    // segment; the reset runs untimed between segments of m_reset_interval calls
+    template<typename TimerT>
+    double time_batch(std::size_t repetitions, double overhead_ns, utils::PerfCounters* counters)
+    {
+        const std::size_t segment = m_reset ? m_reset_interval : repetitions;
+        double elapsed_ns = 0.0;
+        for (std::size_t done = 0; done < repetitions;)
+        {
+            if (done > 0)
+            {
+                m_reset();
+            }
+            const std::size_t calls = std::min(segment, repetitions - done);
+            if (counters != nullptr)
+            {
+                counters->enable();
+            }
+            TimerT timer;
+            timer.start();
+            for (std::size_t i = 0; i < calls; ++i)
+            {
+                m_kernel();
+            }
+            timer.stop();
+            if (counters != nullptr)
+            {
+                counters->disable();
+            }
+            elapsed_ns += std::max(timer.elapsed_ns() - overhead_ns, 0.0);
+            done += calls;
+        }
+        return elapsed_ns;
+    }
+
+    Kernel m_kernel;
+    Reset m_reset;
+    std::size_t m_reset_interval{1};
+    double m_setup_time_ms{0.0};
+    double m_warmup_time_ms{0.0};
+    std::uint64_t m_operand_checksum{0};
+    std::vector<utils::MemoryRegion> m_operands;
+};
+
+// Fixture factories for each BLAS operation
+// Each one allocates and randomizes its operands exactly once; operand contents
+// depend only on the seed, so the same seed reproduces the same data
+
+template<typename T = double>
+BenchmarkFixture make_dot_fixture(std::size_t n, std::uint64_t seed);
 
-// Benchmark function declarations
-// These functions run benchmarks and return average time in milliseconds
+// Conjugated dot product (complex types only)
+template<typename T>
+BenchmarkFixture make_dotc_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_axpy_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_scal_fixture(std::size_t n, std::uint64_t seed);
+
+// `large_magnitude` scales x far beyond sqrt(max) of T (1e200 for double, 1e30 for
+// float) so the sum of squares would overflow and the library must take its scaled path
+template<typename T = double>
+BenchmarkFixture make_nrm2_fixture(std::size_t n, bool large_magnitude, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_asum_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_iamax_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_copy_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_swap_fixture(std::size_t n, std::uint64_t seed);
+
+// Rotation fixtures use an orthogonal rotation, so repeated in-place calls preserve norms
+template<typename T = double>
+BenchmarkFixture make_rot_fixture(std::size_t n, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_rotm_fixture(std::size_t n, std::uint64_t seed);
 
+// General-matrix fixtures take the storage order, transposes and extra leading-dimension
+// elements (ld_padding) from the [layout] sweep; A is m x n (gemv) or op(A) m x k (gemm)
 template<typename T = double>
-double benchmark_dot(std::size_t n, std::size_t warmup, std::size_t cycles,
-                     bool flush_cache, std::size_t cache_size);
+BenchmarkFixture make_gemv_fixture(std::size_t m, std::size_t n, CBLAS_ORDER order, CBLAS_TRANSPOSE trans,
+                                   std::size_t ld_padding, std::uint64_t seed);
 
+// Update fixtures (ger/syr/syr2) alternate the sign of alpha so A stays bounded
 template<typename T = double>
-double benchmark_axpy(std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size);
+BenchmarkFixture make_ger_fixture(std::size_t m, std::size_t n, std::uint64_t seed);
 
 template<typename T = double>
-double benchmark_scal(std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size);
+BenchmarkFixture make_symv_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
 
 template<typename T = double>
-double benchmark_gemv(std::size_t m, std::size_t n, std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size);
+BenchmarkFixture make_trmv_fixture(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                   std::uint64_t seed);
 
 template<typename T = double>
-double benchmark_gemm(std::size_t m, std::size_t n, std::size_t k,
-                      std::size_t warmup, std::size_t cycles,
-                      bool flush_cache, std::size_t cache_size);
+BenchmarkFixture make_trsv_fixture(std::size_t n, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+                                   std::uint64_t seed);
 
-// Benchmark function signature
 template<typename T = double>
-using BenchmarkFunc = std::function<double(
-    std::size_t warmup,
-    std::size_t cycles,
-    bool flush_cache,
-    std::size_t cache_size
-)>;
+BenchmarkFixture make_syr_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_syr2_fixture(std::size_t n, CBLAS_UPLO uplo, std::uint64_t seed);
+
+// Banded fixtures use row-major band storage (kl + ku + 1 or k + 1 entries per row)
+template<typename T = double>
+BenchmarkFixture make_gbmv_fixture(std::size_t m, std::size_t n, std::size_t kl, std::size_t ku,
+                                   CBLAS_TRANSPOSE trans, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_sbmv_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_gemm_fixture(std::size_t m, std::size_t n, std::size_t k, CBLAS_ORDER order,
+                                   CBLAS_TRANSPOSE trans_a, CBLAS_TRANSPOSE trans_b, std::size_t ld_padding,
+                                   std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_symm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_syrk_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                   std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_syr2k_fixture(std::size_t n, std::size_t k, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                                    std::uint64_t seed);
+
+// Triangular fixtures use a diagonally dominant A and restore B periodically,
+// so repeated in-place calls stay finite and free of denormals
+template<typename T = double>
+BenchmarkFixture make_trmm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, std::uint64_t seed);
+
+template<typename T = double>
+BenchmarkFixture make_trsm_fixture(std::size_t m, std::size_t n, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                                   CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, std::uint64_t seed);
+
+// BLAS mode letters from the config ("R"/"C", "L"/"R", "U"/"L", "N"/"T"/"C", "N"/"U"),
+// case-insensitive; throw std::invalid_argument on anything else
+[[nodiscard]] CBLAS_ORDER parse_order(const std::string& name);
+[[nodiscard]] CBLAS_SIDE parse_side(const std::string& name);
+[[nodiscard]] CBLAS_UPLO parse_uplo(const std::string& name);
+[[nodiscard]] CBLAS_TRANSPOSE parse_transpose(const std::string& name);
+[[nodiscard]] CBLAS_DIAG parse_diag(const std::string& name);
 
 } // namespace blas_benchmark
@@ -0,0 +1,775 @@
+#include "benchmark/kernel_registry.h"
+
+#include <complex>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+namespace blas_benchmark
+{
+
+KernelRegistry& KernelRegistry::instance()
+{
+    // Function-local static, so registrars in any translation unit can use it
+    static KernelRegistry registry;
+    return registry;
+}
+
+void KernelRegistry::add(KernelDescriptor kernel)
+{
+    auto name = kernel.name;
+    if (!m_kernels.emplace(name, std::move(kernel)).second)
+    {
+        throw std::logic_error("Kernel registered twice: " + name);
+    }
+}
+
+const KernelDescriptor* KernelRegistry::find(const std::string& name) const
+{
+    auto it = m_kernels.find(name);
+    return it != m_kernels.end() ? &it->second : nullptr;
+}
+
+const KernelDescriptor* KernelRegistry::find_variant(const std::string& operation, char precision) const
+{
+    for (const auto& [name, kernel] : m_kernels)
+    {
+        if (kernel.operation == operation && kernel.precision == precision)
+        {
+            return &kernel;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> KernelRegistry::names(BlasLevel level) const
+{
+    std::vector<std::string> result;
+    for (const auto& [name, kernel] : m_kernels)
+    {
+        if (kernel.level == level)
+        {
+            result.push_back(name);
+        }
+    }
+    return result;
+}
+
+namespace
+{
+
+// Operation descriptors: name, level, fixture factory, FLOP and byte models
+// for one BLAS operation at element type T; `routine()` overrides the report
+// name where it is not the precision prefix followed by the operation name;
+// `layout()` makes the runner sweep the kernel over the [layout] combinations
+
+template<typename T>
+struct DotOp
+{
+    static constexpr const char* name = "dot";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static std::string routine()
+    {
+        return std::string(1, BlasPrecisionTraits<T>::precision_char) +
+               (BlasPrecisionTraits<T>::is_complex ? "dotu_sub" : "dot");
+    }
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_dot_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::dot<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::dot<T>(size.n);
+    }
+};
+
+// Complex only: the real dot product is its own conjugate
+template<typename T>
+struct DotcOp
+{
+    static constexpr const char* name = "dotc";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static std::string routine()
+    {
+        return std::string(1, BlasPrecisionTraits<T>::precision_char) + "dotc_sub";
+    }
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_dotc_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::dot<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::dot<T>(size.n);
+    }
+};
+
+template<typename T>
+struct AxpyOp
+{
+    static constexpr const char* name = "axpy";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_axpy_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::axpy<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::axpy<T>(size.n);
+    }
+};
+
+template<typename T>
+struct ScalOp
+{
+    static constexpr const char* name = "scal";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_scal_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::scal<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::scal<T>(size.n);
+    }
+};
+
+template<typename T>
+struct Nrm2Op
+{
+    static constexpr const char* name = "nrm2";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_nrm2_fixture<T>(size.n, size.large_magnitude, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::nrm2<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::nrm2<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return size.large_magnitude ? "data=large" : "data=normal";
+    }
+};
+
+template<typename T>
+struct AsumOp
+{
+    static constexpr const char* name = "asum";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_asum_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::asum<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::asum<T>(size.n);
+    }
+};
+
+template<typename T>
+struct IamaxOp
+{
+    static constexpr const char* name = "iamax";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static std::string routine()
+    {
+        return std::string("i") + BlasPrecisionTraits<T>::precision_char + "amax";
+    }
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_iamax_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::iamax<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::iamax<T>(size.n);
+    }
+};
+
+template<typename T>
+struct CopyOp
+{
+    static constexpr const char* name = "copy";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_copy_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::copy<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::copy<T>(size.n);
+    }
+};
+
+template<typename T>
+struct SwapOp
+{
+    static constexpr const char* name = "swap";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_swap_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::swap<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::swap<T>(size.n);
+    }
+};
+
+template<typename T>
+struct RotOp
+{
+    static constexpr const char* name = "rot";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_rot_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::rot<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::rot<T>(size.n);
+    }
+};
+
+template<typename T>
+struct RotmOp
+{
+    static constexpr const char* name = "rotm";
+    static constexpr BlasLevel level = BlasLevel::level1;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_rotm_fixture<T>(size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::rotm<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::rotm<T>(size.n);
+    }
+};
+
+// Mode letters for report config strings
+char order_letter(CBLAS_ORDER order)
+{
+    return order == CblasRowMajor ? 'R' : 'C';
+}
+
+char side_letter(CBLAS_SIDE side)
+{
+    return side == CblasLeft ? 'L' : 'R';
+}
+
+char uplo_letter(CBLAS_UPLO uplo)
+{
+    return uplo == CblasUpper ? 'U' : 'L';
+}
+
+char trans_letter(CBLAS_TRANSPOSE trans)
+{
+    return trans == CblasNoTrans ? 'N' : (trans == CblasTrans ? 'T' : 'C');
+}
+
+char diag_letter(CBLAS_DIAG diag)
+{
+    return diag == CblasNonUnit ? 'N' : 'U';
+}
+
+template<typename T>
+struct GemvOp
+{
+    static constexpr const char* name = "gemv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_gemv_fixture<T>(size.m, size.n, size.order, size.trans_a, size.ld_padding, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::gemv<T>(size.m, size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::gemv<T>(size.m, size.n, size.trans_a);
+    }
+    static std::string layout(const ProblemSize& size)
+    {
+        return std::format("{}/{}/+{}", order_letter(size.order), trans_letter(size.trans_a), size.ld_padding);
+    }
+};
+
+template<typename T>
+struct GemmOp
+{
+    static constexpr const char* name = "gemm";
+    static constexpr BlasLevel level = BlasLevel::level3;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_gemm_fixture<T>(size.m, size.n, size.k, size.order, size.trans_a, size.trans_b,
+                                    size.ld_padding, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::gemm<T>(size.m, size.n, size.k);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::gemm<T>(size.m, size.n, size.k);
+    }
+    static std::string layout(const ProblemSize& size)
+    {
+        return std::format("{}/{}{}/+{}", order_letter(size.order), trans_letter(size.trans_a),
+                           trans_letter(size.trans_b), size.ld_padding);
+    }
+};
+
+template<typename T>
+struct GerOp
+{
+    static constexpr const char* name = "ger";
+    static constexpr BlasLevel level = BlasLevel::level2;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_ger_fixture<T>(size.m, size.n, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::ger<T>(size.m, size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::ger<T>(size.m, size.n);
+    }
+};
+
+// Symmetric and triangular Level 2 kernels are square: they use N only
+template<typename T>
+struct SymvOp
+{
+    static constexpr const char* name = "symv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_symv_fixture<T>(size.n, size.uplo, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::symv<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::symv<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={}", uplo_letter(size.uplo));
+    }
+};
+
+template<typename T>
+struct TrmvOp
+{
+    static constexpr const char* name = "trmv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_trmv_fixture<T>(size.n, size.uplo, size.trans, size.diag, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::trmv<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::trmv<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={},trans={},diag={}", uplo_letter(size.uplo), trans_letter(size.trans),
+                           diag_letter(size.diag));
+    }
+};
+
+template<typename T>
+struct TrsvOp
+{
+    static constexpr const char* name = "trsv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_trsv_fixture<T>(size.n, size.uplo, size.trans, size.diag, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::trsv<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::trsv<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={},trans={},diag={}", uplo_letter(size.uplo), trans_letter(size.trans),
+                           diag_letter(size.diag));
+    }
+};
+
+template<typename T>
+struct SyrOp
+{
+    static constexpr const char* name = "syr";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_syr_fixture<T>(size.n, size.uplo, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::syr<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::syr<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={}", uplo_letter(size.uplo));
+    }
+};
+
+template<typename T>
+struct Syr2Op
+{
+    static constexpr const char* name = "syr2";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_syr2_fixture<T>(size.n, size.uplo, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::syr2<T>(size.n);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::syr2<T>(size.n);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={}", uplo_letter(size.uplo));
+    }
+};
+
+template<typename T>
+struct GbmvOp
+{
+    static constexpr const char* name = "gbmv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_gbmv_fixture<T>(size.m, size.n, size.kl, size.ku, size.trans, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::gbmv<T>(size.m, size.n, size.kl, size.ku);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::gbmv<T>(size.m, size.n, size.kl, size.ku, size.trans);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("kl={},ku={},trans={}", size.kl, size.ku, trans_letter(size.trans));
+    }
+};
+
+template<typename T>
+struct SbmvOp
+{
+    static constexpr const char* name = "sbmv";
+    static constexpr BlasLevel level = BlasLevel::level2;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_sbmv_fixture<T>(size.n, size.ku, size.uplo, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::sbmv<T>(size.n, size.ku);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::sbmv<T>(size.n, size.ku);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("k={},uplo={}", size.ku, uplo_letter(size.uplo));
+    }
+};
+
+template<typename T>
+struct SymmOp
+{
+    static constexpr const char* name = "symm";
+    static constexpr BlasLevel level = BlasLevel::level3;
+    static constexpr bool uses_k = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_symm_fixture<T>(size.m, size.n, size.side, size.uplo, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::symm<T>(size.m, size.n, size.side);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::symm<T>(size.m, size.n, size.side);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("side={},uplo={}", side_letter(size.side), uplo_letter(size.uplo));
+    }
+};
+
+// syrk/syr2k: C is N x N, the inner dimension is K
+template<typename T>
+struct SyrkOp
+{
+    static constexpr const char* name = "syrk";
+    static constexpr BlasLevel level = BlasLevel::level3;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_syrk_fixture<T>(size.n, size.k, size.uplo, size.trans, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::syrk<T>(size.n, size.k);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::syrk<T>(size.n, size.k);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={},trans={}", uplo_letter(size.uplo), trans_letter(size.trans));
+    }
+};
+
+template<typename T>
+struct Syr2kOp
+{
+    static constexpr const char* name = "syr2k";
+    static constexpr BlasLevel level = BlasLevel::level3;
+    static constexpr bool uses_m = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_syr2k_fixture<T>(size.n, size.k, size.uplo, size.trans, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::syr2k<T>(size.n, size.k);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::syr2k<T>(size.n, size.k);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("uplo={},trans={}", uplo_letter(size.uplo), trans_letter(size.trans));
+    }
+};
+
+template<typename T>
+struct TrmmOp
+{
+    static constexpr const char* name = "trmm";
+    static constexpr BlasLevel level = BlasLevel::level3;
+    static constexpr bool uses_k = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_trmm_fixture<T>(size.m, size.n, size.side, size.uplo, size.trans, size.diag, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::trmm<T>(size.m, size.n, size.side);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::trmm<T>(size.m, size.n, size.side);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("side={},uplo={},trans={},diag={}", side_letter(size.side), uplo_letter(size.uplo),
+                           trans_letter(size.trans), diag_letter(size.diag));
+    }
+};
+
+template<typename T>
+struct TrsmOp
+{
+    static constexpr const char* name = "trsm";
+    static constexpr BlasLevel level = BlasLevel::level3;
+    static constexpr bool uses_k = false;
+
+    static BenchmarkFixture make_fixture(const ProblemSize& size, std::uint64_t seed)
+    {
+        return make_trsm_fixture<T>(size.m, size.n, size.side, size.uplo, size.trans, size.diag, seed);
+    }
+    static std::size_t flops(const ProblemSize& size)
+    {
+        return flops::trsm<T>(size.m, size.n, size.side);
+    }
+    static Traffic bytes(const ProblemSize& size)
+    {
+        return bytes::trsm<T>(size.m, size.n, size.side);
+    }
+    static std::string modes(const ProblemSize& size)
+    {
+        return std::format("side={},uplo={},trans={},diag={}", side_letter(size.side), uplo_letter(size.uplo),
+                           trans_letter(size.trans), diag_letter(size.diag));
+    }
+};
+
+// Static registration of every (operation, precision) pair
+const KernelRegistrar<DotOp, float> sdot_registrar;
+const KernelRegistrar<DotOp, double> ddot_registrar;
+const KernelRegistrar<AxpyOp, float> saxpy_registrar;
+const KernelRegistrar<AxpyOp, double> daxpy_registrar;
+const KernelRegistrar<ScalOp, float> sscal_registrar;
+const KernelRegistrar<ScalOp, double> dscal_registrar;
+const KernelRegistrar<Nrm2Op, float> snrm2_registrar;
+const KernelRegistrar<Nrm2Op, double> dnrm2_registrar;
+const KernelRegistrar<AsumOp, float> sasum_registrar;
+const KernelRegistrar<AsumOp, double> dasum_registrar;
+const KernelRegistrar<IamaxOp, float> isamax_registrar;
+const KernelRegistrar<IamaxOp, double> idamax_registrar;
+const KernelRegistrar<CopyOp, float> scopy_registrar;
+const KernelRegistrar<CopyOp, double> dcopy_registrar;
+const KernelRegistrar<SwapOp, float> sswap_registrar;
+const KernelRegistrar<SwapOp, double> dswap_registrar;
+const KernelRegistrar<RotOp, float> srot_registrar;
+const KernelRegistrar<RotOp, double> drot_registrar;
+const KernelRegistrar<RotmOp, float> srotm_registrar;
+const KernelRegistrar<RotmOp, double> drotm_registrar;
+const KernelRegistrar<GemvOp, float> sgemv_registrar;
+const KernelRegistrar<GemvOp, double> dgemv_registrar;
+const KernelRegistrar<GemmOp, float> sgemm_registrar;
+const KernelRegistrar<GemmOp, double> dgemm_registrar;
+const KernelRegistrar<GerOp, float> sger_registrar;
+const KernelRegistrar<GerOp, double> dger_registrar;
+const KernelRegistrar<SymvOp, float> ssymv_registrar;
+const KernelRegistrar<SymvOp, double> dsymv_registrar;
+const KernelRegistrar<TrmvOp, float> strmv_registrar;
+const KernelRegistrar<TrmvOp, double> dtrmv_registrar;
+const KernelRegistrar<TrsvOp, float> strsv_registrar;
+const KernelRegistrar<TrsvOp, double> dtrsv_registrar;
+const KernelRegistrar<SyrOp, float> ssyr_registrar;
+const KernelRegistrar<SyrOp, double> dsyr_registrar;
+const KernelRegistrar<Syr2Op, float> ssyr2_registrar;
+const KernelRegistrar<Syr2Op, double> dsyr2_registrar;
+const KernelRegistrar<GbmvOp, float> sgbmv_registrar;
+const KernelRegistrar<GbmvOp, double> dgbmv_registrar;
+const KernelRegistrar<SbmvOp, float> ssbmv_registrar;
+const KernelRegistrar<SbmvOp, double> dsbmv_registrar;
+const KernelRegistrar<SymmOp, float> ssymm_registrar;
+const KernelRegistrar<SymmOp, double> dsymm_registrar;
+const KernelRegistrar<SyrkOp, float> ssyrk_registrar;
+const KernelRegistrar<SyrkOp, double> dsyrk_registrar;
+const KernelRegistrar<Syr2kOp, float> ssyr2k_registrar;
+const KernelRegistrar<Syr2kOp, double> dsyr2k_registrar;
+const KernelRegistrar<TrmmOp, float> strmm_registrar;
+const KernelRegistrar<TrmmOp, double> dtrmm_registrar;
+const KernelRegistrar<TrsmOp, float> strsm_registrar;
+const KernelRegistrar<TrsmOp, double> dtrsm_registrar;
+
+const KernelRegistrar<DotOp, std::complex<float>> cdotu_sub_registrar;
+const KernelRegistrar<DotOp, std::complex<double>> zdotu_sub_registrar;
+const KernelRegistrar<DotcOp, std::complex<float>> cdotc_sub_registrar;
+const KernelRegistrar<DotcOp, std::complex<double>> zdotc_sub_registrar;
+const KernelRegistrar<AxpyOp, std::complex<float>> caxpy_registrar;
+const KernelRegistrar<AxpyOp, std::complex<double>> zaxpy_registrar;
+const KernelRegistrar<ScalOp, std::complex<float>> cscal_registrar;
+const KernelRegistrar<ScalOp, std::complex<double>> zscal_registrar;
+const KernelRegistrar<GemvOp, std::complex<float>> cgemv_registrar;
+const KernelRegistrar<GemvOp, std::complex<double>> zgemv_registrar;
+const KernelRegistrar<GemmOp, std::complex<float>> cgemm_registrar;
+const KernelRegistrar<GemmOp, std::complex<double>> zgemm_registrar;
+
+} // anonymous namespace
+
+} // namespace blas_benchmark
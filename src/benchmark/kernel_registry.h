@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "benchmark/blas_functions.h"
+
+namespace blas_benchmark
+{
+
+// BLAS level a kernel belongs to (selects the [functions] list and problem size)
+enum class BlasLevel
+{
+    level1 = 1,
+    level2 = 2,
+    level3 = 3
+};
+
+// Problem dimensions of one benchmark; Level 1 uses n, Level 2 m/n, Level 3 m/n/k
+// Symmetric, triangular and banded kernels also take their BLAS mode arguments
+// and bandwidths from here; gemv/gemm take their storage layout ([layout] sweep)
+struct ProblemSize
+{
+    std::size_t m{0};
+    std::size_t n{0};
+    std::size_t k{0};
+    std::size_t kl{0}; // Sub-diagonals of banded matrices
+    std::size_t ku{0}; // Super-diagonals (the half-bandwidth of sbmv)
+    bool large_magnitude{false}; // nrm2 inputs beyond sqrt(max) of the type
+
+    CBLAS_SIDE side{CblasLeft};
+    CBLAS_UPLO uplo{CblasUpper};
+    CBLAS_TRANSPOSE trans{CblasNoTrans};
+    CBLAS_DIAG diag{CblasNonUnit};
+
+    CBLAS_ORDER order{CblasRowMajor};
+    CBLAS_TRANSPOSE trans_a{CblasNoTrans}; // op(A) of gemv and gemm
+    CBLAS_TRANSPOSE trans_b{CblasNoTrans}; // op(B) of gemm
+    std::size_t ld_padding{0};             // Extra elements per leading dimension
+};
+
+// Everything the runner needs to benchmark one (operation, precision) pair
+struct KernelDescriptor
+{
+    std::string name;       // Config name, e.g. "cblas_dgemm"
+    std::string short_name; // Report name, e.g. "dgemm" or "zdotc_sub"
+    std::string operation;  // Precision-independent name, e.g. "gemm"
+    BlasLevel level{BlasLevel::level1};
+    char precision{'d'};       // BLAS prefix: s, d, c or z
+    std::size_t real_bits{64}; // Width of one real component, for FP vector width
+
+    std::function<BenchmarkFixture(const ProblemSize&, std::uint64_t seed)> make_fixture;
+    std::function<std::size_t(const ProblemSize&)> flops;
+    std::function<Traffic(const ProblemSize&)> bytes;
+
+    // Mode arguments the kernel uses, appended to the report config (e.g. "side=L,uplo=U");
+    // empty for kernels without any
+    std::function<std::string(const ProblemSize&)> modes;
+
+    // Storage layout tag of general-matrix kernels (e.g. "R/NT/+8": order, transposes,
+    // ld padding); set only for kernels swept over the [layout] combinations
+    std::function<std::string(const ProblemSize&)> layout;
+
+    // Which of the level's M and K the kernel reads (N always is); unused ones stay out of
+    // its report config: square Level 2 kernels and syrk/syr2k ignore M, symm/trmm/trsm K
+    bool uses_m{true};
+    bool uses_k{true};
+};
+
+// All benchmarkable kernels, keyed by config name
+// Kernels add themselves at static-initialization time through KernelRegistrar
+class KernelRegistry
+{
+public:
+    [[nodiscard]] static KernelRegistry& instance();
+
+    // Throws std::logic_error on a duplicate name
+    void add(KernelDescriptor kernel);
+
+    // nullptr if no kernel has this name
+    [[nodiscard]] const KernelDescriptor* find(const std::string& name) const;
+
+    // The same operation in another precision (s, d, c or z); nullptr if not registered
+    [[nodiscard]] const KernelDescriptor* find_variant(const std::string& operation, char precision) const;
+
+    // Config names of the kernels of one level, sorted
+    [[nodiscard]] std::vector<std::string> names(BlasLevel level) const;
+
+private:
+    KernelRegistry() = default;
+
+    std::map<std::string, KernelDescriptor> m_kernels;
+};
+
+// Registers operation Op (a descriptor template, see kernel_registry.cpp) for
+// element type T; define one as a namespace-scope constant per pair
+template<template<typename> class Op, typename T>
+struct KernelRegistrar
+{
+    KernelRegistrar()
+    {
+        using Operation = Op<T>;
+        constexpr char prefix = BlasPrecisionTraits<T>::precision_char;
+
+        KernelDescriptor kernel;
+        if constexpr (requires { Operation::routine(); })
+        {
+            kernel.short_name = Operation::routine();
+        }
+        else
+        {
+            kernel.short_name = std::string(1, prefix) + Operation::name;
+        }
+        kernel.name = "cblas_" + kernel.short_name;
+        kernel.operation = Operation::name;
+        kernel.level = Operation::level;
+        kernel.precision = prefix;
+        kernel.real_bits = sizeof(typename BlasPrecisionTraits<T>::real_type) * 8;
+        kernel.make_fixture = &Operation::make_fixture;
+        kernel.flops = &Operation::flops;
+        kernel.bytes = &Operation::bytes;
+        if constexpr (requires { &Operation::modes; })
+        {
+            kernel.modes = &Operation::modes;
+        }
+        if constexpr (requires { &Operation::layout; })
+        {
+            kernel.layout = &Operation::layout;
+        }
+        if constexpr (requires { Operation::uses_m; })
+        {
+            kernel.uses_m = Operation::uses_m;
+        }
+        if constexpr (requires { Operation::uses_k; })
+        {
+            kernel.uses_k = Operation::uses_k;
+        }
+        KernelRegistry::instance().add(std::move(kernel));
+    }
+};
+
+} // namespace blas_benchmark
@@ -1,11 +1,21 @@
 #include "config/config_parser.h"
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
+#include <spdlog/spdlog.h>
 #include <toml.hpp>
 
+#include "benchmark/kernel_registry.h"
+#include "utils/affinity.h"
+#include "utils/cache_flusher.h"
+#include "utils/scaling.h"
+#include "utils/timer.h"
+
 namespace blas_benchmark::config
 {
 
@@ -42,8 +52,172 @@ std::tuple<int, int, int> parse_size_triple(const std::string& str)
     return {m, n, k};
 }
 
+// Reject names that are not registered kernels of this level, listing the valid ones
+void validate_functions(const std::vector<std::string>& functions, BlasLevel level)
+{
+    const auto& registry = KernelRegistry::instance();
+    for (const auto& name : functions)
+    {
+        const auto* kernel = registry.find(name);
+        if (kernel != nullptr && kernel->level == level)
+        {
+            continue;
+        }
+
+        std::string available;
+        for (const auto& candidate : registry.names(level))
+        {
+            available += (available.empty() ? "" : ", ") + candidate;
+        }
+        throw std::invalid_argument("Unknown Level " + std::to_string(static_cast<int>(level)) +
+                                    " function '" + name + "' (available: " + available + ")");
+    }
+}
+
+// Replace each function by its variants in the requested precisions, in order,
+// dropping duplicates (e.g. both cblas_sdot and cblas_ddot listed) and, with a
+// warning, precisions the operation does not exist in; throws std::invalid_argument
+// if none of a level's functions exists in any requested precision
+void expand_precisions(std::vector<std::string>& functions, const std::vector<std::string>& precisions,
+                       BlasLevel level)
+{
+    if (precisions.empty() || functions.empty())
+    {
+        return;
+    }
+
+    const auto& registry = KernelRegistry::instance();
+    std::vector<std::string> expanded;
+    for (const auto& name : functions)
+    {
+        const auto* kernel = registry.find(name);
+        for (const auto& prefix : precisions)
+        {
+            const auto* variant = registry.find_variant(kernel->operation, prefix[0]);
+            // E.g. complex-only dotc has no real variants, real-only syrk-style names no complex ones
+            if (variant == nullptr)
+            {
+                spdlog::warn("{} has no '{}' precision variant; skipped for that precision", name, prefix);
+                continue;
+            }
+            if (std::find(expanded.begin(), expanded.end(), variant->name) == expanded.end())
+            {
+                expanded.push_back(variant->name);
+            }
+        }
+    }
+    if (expanded.empty())
+    {
+        throw std::invalid_argument("No Level " + std::to_string(static_cast<int>(level)) +
+                                    " function exists in the requested precisions");
+    }
+    functions = std::move(expanded);
+}
+
+// A [layout] entry: one value or an array of values
+template<typename T, typename NodeView>
+std::vector<T> value_list(const NodeView& node, const char* key)
+{
+    std::vector<T> values;
+    if (const auto* arr = node.as_array())
+    {
+        for (const auto& item : *arr)
+        {
+            auto value = item.template value<T>();
+            if (!value)
+            {
+                throw std::invalid_argument(std::string("Invalid [layout] ") + key + " entry");
+            }
+            values.push_back(*value);
+        }
+    }
+    else if (auto value = node.template value<T>())
+    {
+        values.push_back(*value);
+    }
+    if (values.empty())
+    {
+        throw std::invalid_argument(std::string("[layout] ") + key + " must not be empty");
+    }
+    return values;
+}
+
+int parse_thread_count(const std::string& str, const std::string& spec)
+{
+    std::size_t end = 0;
+    int count = 0;
+    try
+    {
+        count = std::stoi(str, &end);
+    }
+    catch (const std::exception&)
+    {
+        end = 0;
+    }
+    if (end == 0 || end != str.size() || count < 1)
+    {
+        throw std::invalid_argument("Invalid thread count '" + str + "' in '" + spec + "'");
+    }
+    return count;
+}
+
 } // anonymous namespace
 
+std::vector<std::string> parse_thread_spec(const std::string& spec)
+{
+    std::vector<std::string> counts;
+    std::stringstream list(spec);
+    std::string item;
+    while (std::getline(list, item, ','))
+    {
+        item.erase(std::remove_if(item.begin(), item.end(), [](unsigned char c) { return std::isspace(c); }),
+                   item.end());
+        if (item == "physical" || item == "logical")
+        {
+            counts.push_back(item);
+            continue;
+        }
+
+        auto first_colon = item.find(':');
+        if (first_colon == std::string::npos)
+        {
+            counts.push_back(std::to_string(parse_thread_count(item, spec)));
+            continue;
+        }
+
+        // Range first:last[:+step | :xfactor]
+        auto second_colon = item.find(':', first_colon + 1);
+        int first = parse_thread_count(item.substr(0, first_colon), spec);
+        int last = parse_thread_count(item.substr(first_colon + 1, second_colon - first_colon - 1), spec);
+        std::string step = second_colon == std::string::npos ? "+1" : item.substr(second_colon + 1);
+        if (step.empty() || step == "+" || step == "x")
+        {
+            throw std::invalid_argument("Invalid thread range '" + item + "'");
+        }
+        bool geometric = step[0] == 'x';
+        int amount = parse_thread_count(step[0] == 'x' || step[0] == '+' ? step.substr(1) : step, spec);
+        if (first > last || (geometric && amount < 2))
+        {
+            throw std::invalid_argument("Invalid thread range '" + item + "'");
+        }
+        for (int count = first; count <= last; count = geometric ? count * amount : count + amount)
+        {
+            counts.push_back(std::to_string(count));
+            // The step past last must still fit in an int for the loop to end
+            constexpr int max_count = std::numeric_limits<int>::max();
+            if (geometric ? count > max_count / amount : count > max_count - amount)
+            {
+                throw std::invalid_argument("Thread range '" + item + "' overflows int");
+            }
+        }
+    }
+    if (counts.empty())
+    {
+        throw std::invalid_argument("Empty thread spec '" + spec + "'");
+    }
+    return counts;
+}
+
 BenchmarkConfig ConfigParser::parse_file(const std::string& path) const
 {
     std::ifstream file(path);
@@ -108,6 +282,24 @@ BenchmarkConfig ConfigParser::parse_string(const std::string& content) const
                     }
                 }
             }
+
+            if (functions.as_table()->contains("precision"))
+            {
+                auto arr = functions["precision"].as_array();
+                if (arr)
+                {
+                    for (const auto& item : *arr)
+                    {
+                        std::string prefix = item.value_or("");
+                        if (prefix != "s" && prefix != "d" && prefix != "c" && prefix != "z")
+                        {
+                            throw std::invalid_argument("Invalid precision '" + prefix +
+                                                        "' (expected \"s\", \"d\", \"c\" or \"z\")");
+                        }
+                        config.precisions.push_back(prefix);
+                    }
+                }
+            }
         }
 
         // Parse weights section
@@ -163,10 +355,71 @@ BenchmarkConfig ConfigParser::parse_string(const std::string& content) const
         {
             auto defaults = tbl["defaults"];
 
-            config.threads = defaults["threads"].value_or(config.threads);
+            // threads = 4, threads = "1:64:x2" or threads = [1, 2, 4, "physical", "logical"]
+            if (const auto* arr = defaults["threads"].as_array())
+            {
+                std::string spec;
+                for (const auto& item : *arr)
+                {
+                    auto entry = item.is_integer() ? std::to_string(item.value_or(0)) : item.value_or("");
+                    spec += (spec.empty() ? "" : ",") + entry;
+                }
+                config.thread_sweep = parse_thread_spec(spec);
+            }
+            else if (defaults["threads"].is_string())
+            {
+                config.thread_sweep = parse_thread_spec(defaults["threads"].value_or(""));
+            }
+            else
+            {
+                config.threads = defaults["threads"].value_or(config.threads);
+            }
             config.warmup = defaults["warmup"].value_or(config.warmup);
             config.cycles = defaults["cycles"].value_or(config.cycles);
-            config.flush_cache = defaults["flush_cache"].value_or(config.flush_cache);
+            config.scaling = defaults["scaling"].value_or(config.scaling);
+            config.pin = defaults["pin"].value_or(config.pin);
+            config.instances = defaults["instances"].value_or(config.instances);
+            config.smt_compare = defaults["smt_compare"].value_or(config.smt_compare);
+            config.adaptive = defaults["adaptive"].value_or(config.adaptive);
+            config.target_precision = defaults["target_precision"].value_or(config.target_precision);
+            config.min_cycles = defaults["min_cycles"].value_or(config.min_cycles);
+            config.max_cycles = defaults["max_cycles"].value_or(config.max_cycles);
+            config.time_budget_sec = defaults["time_budget_sec"].value_or(config.time_budget_sec);
+            config.min_sample_time_ms = defaults["min_sample_time_ms"].value_or(config.min_sample_time_ms);
+            config.timer = defaults["timer"].value_or(config.timer);
+            config.perf_counters = defaults["perf_counters"].value_or(config.perf_counters);
+            config.roofline = defaults["roofline"].value_or(config.roofline);
+
+            // flush_cache = true/false is kept as an alias for "sweep"/"none"
+            if (defaults["flush_cache"].is_boolean())
+            {
+                config.flush_cache = defaults["flush_cache"].value_or(true) ? "sweep" : "none";
+            }
+            else
+            {
+                config.flush_cache = defaults["flush_cache"].value_or(config.flush_cache);
+            }
+            config.flush_huge_pages = defaults["flush_huge_pages"].value_or(config.flush_huge_pages);
+            config.flush_numa = defaults["flush_numa"].value_or(config.flush_numa);
+            config.warm_cold = defaults["warm_cold"].value_or(config.warm_cold);
+            config.large_magnitude = defaults["large_magnitude"].value_or(config.large_magnitude);
+            config.band_kl = defaults["band_kl"].value_or(config.band_kl);
+            config.band_ku = defaults["band_ku"].value_or(config.band_ku);
+            config.side = defaults["side"].value_or(config.side);
+            config.uplo = defaults["uplo"].value_or(config.uplo);
+            config.trans = defaults["trans"].value_or(config.trans);
+            config.diag = defaults["diag"].value_or(config.diag);
+
+            if (defaults.as_table()->contains("seed"))
+            {
+                // TOML integers are signed 64-bit; a negative one is no valid seed
+                auto seed = defaults["seed"].value_or(std::int64_t{0});
+                if (seed < 0)
+                {
+                    throw std::invalid_argument("seed must not be negative");
+                }
+                config.seed = static_cast<std::uint64_t>(seed);
+            }
 
             if (defaults.as_table()->contains("level1_size"))
             {
@@ -189,12 +442,80 @@ BenchmarkConfig ConfigParser::parse_string(const std::string& content) const
                 };
             }
         }
+
+        // Parse layout section (gemv/gemm storage sweep)
+        if (tbl.contains("layout"))
+        {
+            auto layout = tbl["layout"];
+
+            if (layout.as_table()->contains("order"))
+            {
+                config.layout_orders = value_list<std::string>(layout["order"], "order");
+            }
+            if (layout.as_table()->contains("trans_a"))
+            {
+                config.layout_trans_a = value_list<std::string>(layout["trans_a"], "trans_a");
+            }
+            if (layout.as_table()->contains("trans_b"))
+            {
+                config.layout_trans_b = value_list<std::string>(layout["trans_b"], "trans_b");
+            }
+            if (layout.as_table()->contains("ld_padding"))
+            {
+                config.ld_paddings = value_list<int>(layout["ld_padding"], "ld_padding");
+            }
+        }
     }
     catch (const toml::parse_error& e)
     {
         throw std::runtime_error(std::string("TOML parse error: ") + e.what());
     }
 
+    validate_functions(config.level1_functions, BlasLevel::level1);
+    validate_functions(config.level2_functions, BlasLevel::level2);
+    validate_functions(config.level3_functions, BlasLevel::level3);
+
+    expand_precisions(config.level1_functions, config.precisions, BlasLevel::level1);
+    expand_precisions(config.level2_functions, config.precisions, BlasLevel::level2);
+    expand_precisions(config.level3_functions, config.precisions, BlasLevel::level3);
+
+    if (config.band_kl < 0 || config.band_ku < 0)
+    {
+        throw std::invalid_argument("band_kl and band_ku must not be negative");
+    }
+
+    (void)utils::parse_flush_mode(config.flush_cache);
+    (void)utils::parse_numa_placement(config.flush_numa);
+    (void)utils::parse_timer_source(config.timer);
+    (void)utils::parse_scaling_mode(config.scaling);
+    (void)utils::parse_pin_spec(config.pin);
+    if (config.instances < 1)
+    {
+        throw std::invalid_argument("instances must be at least 1");
+    }
+
+    // Mode letters throw std::invalid_argument when invalid
+    (void)parse_side(config.side);
+    (void)parse_uplo(config.uplo);
+    (void)parse_transpose(config.trans);
+    (void)parse_diag(config.diag);
+    for (const auto& order : config.layout_orders)
+    {
+        (void)parse_order(order);
+    }
+    for (const auto& trans : config.layout_trans_a)
+    {
+        (void)parse_transpose(trans);
+    }
+    for (const auto& trans : config.layout_trans_b)
+    {
+        (void)parse_transpose(trans);
+    }
+    if (std::any_of(config.ld_paddings.begin(), config.ld_paddings.end(), [](int pad) { return pad < 0; }))
+    {
+        throw std::invalid_argument("ld_padding must not be negative");
+    }
+
     return config;
 }
 
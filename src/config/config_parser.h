@@ -16,15 +16,78 @@ struct BenchmarkConfig
 {
     // Execution parameters
     int threads{1};
+
+    // Thread counts to sweep ("4", "physical" or "logical"); every kernel is rerun at
+    // each count and a scaling report is added. Empty runs `threads` only
+    std::vector<std::string> thread_sweep;
+
+    // Scaling experiment of a thread sweep: "strong" (fixed sizes), "weak" (sizes grow so
+    // M*N*K, M*N or N stays proportional to the thread count) or "both"
+    std::string scaling{"strong"};
+
+    // Thread pinning: "none", "compact", "scatter", "physical-only" or a CPU list ("0,2,4-7")
+    std::string pin{"none"};
+
+    // Throughput mode: after each kernel's latency run, run this many independent copies
+    // at once, each on its own thread and fixture with `threads` OpenBLAS threads; 1 disables
+    int instances{1};
+
+    // Run every kernel twice per thread count (2 or more), pinned to one hardware thread per
+    // physical core and packed onto SMT siblings, and report the SMT gain; overrides `pin`
+    bool smt_compare{false};
     int cycles{5};
     int warmup{3};
-    bool flush_cache{true};
+
+    // Adaptive sampling: keep timing until the median's 95% CI is tight enough
+    bool adaptive{false};
+    double target_precision{0.01}; // Relative CI half-width on the median
+    int min_cycles{5};
+    int max_cycles{1000};
+    double time_budget_sec{10.0};  // Per benchmark series
+
+    // Short kernels are repeated back-to-back until one sample lasts at least this long
+    double min_sample_time_ms{1.0};
+
+    // Sample timer: "auto" (tsc if invariant), "tsc" or "chrono"
+    std::string timer{"auto"};
+
+    // Count cycles, instructions, LLC/dTLB and FP_ARITH events with perf_event_open
+    bool perf_counters{false};
+
+    // Measure FMA peaks and L2/L3/DRAM bandwidth, then place each kernel on the roofline
+    bool roofline{false};
+    std::string flush_cache{"sweep"}; // "sweep", "clflush", "none" or "warm"
+    bool flush_huge_pages{false};     // Back the flush buffer with huge pages
+    std::string flush_numa{"local"};  // "local", "interleave" or "per-node"
+    bool warm_cold{false};            // Time every kernel with both warm and cold caches
+
+    // Operand RNG seed; a random seed is drawn (and reported) when unset
+    std::optional<std::uint64_t> seed;
 
     // Test sizes for each BLAS level
     std::optional<std::size_t> level1_size;
     std::optional<std::pair<int, int>> level2_size;      // (M, N)
     std::optional<std::tuple<int, int, int>> level3_size; // (M, N, K)
 
+    // Fill nrm2 inputs with magnitudes whose squares overflow, forcing the scaled path
+    bool large_magnitude{false};
+
+    // Bandwidths of the banded Level 2 kernels; sbmv uses band_ku as its half-bandwidth
+    int band_kl{16};
+    int band_ku{16};
+
+    // BLAS mode letters for symmetric/triangular kernels (Level 2 and 3)
+    std::string side{"L"};  // "L" or "R"
+    std::string uplo{"U"};  // "U" or "L"
+    std::string trans{"N"}; // "N", "T" or "C"
+    std::string diag{"N"};  // "N" (non-unit) or "U" (unit)
+
+    // Storage layouts gemv and gemm are swept over ([layout]); every combination is run
+    std::vector<std::string> layout_orders{"R"};  // "R" (row-major) or "C" (column-major)
+    std::vector<std::string> layout_trans_a{"N"}; // op(A): "N", "T" or "C"
+    std::vector<std::string> layout_trans_b{"N"}; // op(B), gemm only
+    std::vector<int> ld_paddings{0};              // Extra elements per leading dimension
+
     // Output configuration
     std::string output_file;
     std::string format{"markdown"}; // "markdown" or "csv"
@@ -34,13 +97,25 @@ struct BenchmarkConfig
     std::vector<std::string> level2_functions;
     std::vector<std::string> level3_functions;
 
+    // BLAS precision prefixes ("s", "d", "c", "z") each listed function is expanded to;
+    // empty runs the functions exactly as named
+    std::vector<std::string> precisions;
+
     // Function weights for scoring
     std::vector<std::pair<std::string, double>> level1_weights;
     std::vector<std::pair<std::string, double>> level2_weights;
     std::vector<std::pair<std::string, double>> level3_weights;
 };
 
+// Thread counts from a spec: a comma-separated list of counts, "physical", "logical"
+// and ranges "first:last" (step 1), "first:last:+step" or "first:last:xfactor",
+// e.g. "1:64:x2" or "1,2,4,physical"; throws std::invalid_argument when malformed
+[[nodiscard]] std::vector<std::string> parse_thread_spec(const std::string& spec);
+
 // Configuration file parser using TOML
+// Function names are checked against the kernel registry; unknown names throw
+// std::invalid_argument listing the available kernels. With `precision` set, each
+// function is replaced by its variants in the listed precisions
 class ConfigParser
 {
 public:
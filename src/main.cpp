@@ -6,6 +6,7 @@
 #include <functional>
 #include <optional>
 #include <print>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -13,7 +14,10 @@
 #include <spdlog/spdlog.h>
 
 #include "benchmark/benchmark.h"
+#include "benchmark/kernel_registry.h"
 #include "config/config_parser.h"
+#include "utils/affinity.h"
+#include "utils/scaling.h"
 #include "utils/system_info.h"
 
 namespace
@@ -111,21 +115,38 @@ int main(int argc, char *argv[])
     CLI::App app{"BLAS Benchmark - Performance testing for BLAS operations"};
 
     // Command line options
-    int threads = 1;
+    std::string threads_str;
     int cycles = 5;
     int warmup = 3;
     std::string level1_str;
     std::string level2_str;
     std::string level3_str;
+    std::string seed_str;
+    std::string scaling;
+    std::string pin;
+    int instances = 1;
     std::string output_file;
     std::string format = "markdown";
     std::string config_file = "config.toml";
+    bool warm_cold = false;
+    bool adaptive = false;
+    bool perf_counters = false;
+    bool roofline = false;
+    bool smt_compare = false;
+    double precision = 0.0;
     bool verbose = false;
     bool show_system_info = false;
+    bool list_kernels = false;
 
     // Add options
-    app.add_option("-t,--threads", threads, "Number of threads")
-        ->default_val(1);
+    auto* threads_option = app.add_option("-t,--threads", threads_str,
+                                          "Number of threads, or a sweep: list (1,2,physical) or range (1:64:x2)");
+    auto* scaling_option = app.add_option("--scaling", scaling,
+                                          "Thread sweep experiment: strong (fixed size), weak (size grows with threads) or both");
+    auto* pin_option = app.add_option("--pin", pin,
+                                      "Thread pinning: none, compact, scatter, physical-only or a CPU list (0,2,4-7)");
+    auto* instances_option = app.add_option("--instances", instances,
+                                            "Throughput mode: concurrent independent calls per kernel, each with --threads threads");
     app.add_option("-c,--cycle", cycles, "Number of benchmark cycles")
         ->default_val(5);
     app.add_option("-w,--warmup", warmup, "Number of warmup iterations")
@@ -133,15 +154,31 @@ int main(int argc, char *argv[])
     app.add_option("-1,--level1", level1_str, "Level 1 vector size (N)");
     app.add_option("-2,--level2", level2_str, "Level 2 matrix size (M,N)");
     app.add_option("-3,--level3", level3_str, "Level 3 matrix size (M,N,K)");
+    app.add_option("--seed", seed_str,
+                   "Operand RNG seed (random if unset, always reported)");
     app.add_option("-o,--output", output_file, "Output file path")
         ->default_val("");
     app.add_option("-f,--format", format, "Output format (markdown|csv)")
         ->default_val("markdown");
     app.add_option("-C,--config", config_file, "Configuration file path")
         ->default_val("config.toml");
+    app.add_flag("--adaptive", adaptive,
+                 "Sample until the median's 95% CI reaches the target precision");
+    app.add_option("--precision", precision,
+                   "Adaptive target: relative CI half-width on the median (e.g. 0.01)");
+    app.add_flag("--perf", perf_counters,
+                 "Count hardware events (cycles, instructions, LLC, dTLB, FP width) per call");
+    app.add_flag("--roofline", roofline,
+                 "Measure machine peaks and report each kernel's % of its roofline bound");
+    app.add_flag("--smt-compare", smt_compare,
+                 "Run each kernel on one thread per core and on SMT siblings; report the SMT gain");
+    app.add_flag("--warm-cold", warm_cold,
+                 "Report warm- and cold-cache timings for every kernel");
     app.add_flag("-v,--verbose", verbose, "Enable verbose output");
     app.add_flag("-s,--system-info", show_system_info,
                  "Show system information only");
+    app.add_flag("--list-kernels", list_kernels,
+                 "List the registered kernels per level and exit");
 
     // Parse arguments
     try
@@ -163,6 +200,22 @@ int main(int argc, char *argv[])
         spdlog::set_level(spdlog::level::info);
     }
 
+    // List registered kernels only
+    if (list_kernels)
+    {
+        const auto& registry = blas_benchmark::KernelRegistry::instance();
+        for (auto level : {blas_benchmark::BlasLevel::level1, blas_benchmark::BlasLevel::level2,
+                           blas_benchmark::BlasLevel::level3})
+        {
+            std::println("Level {}:", static_cast<int>(level));
+            for (const auto& name : registry.names(level))
+            {
+                std::println("  {}", name);
+            }
+        }
+        return 0;
+    }
+
     // Show system info only
     if (show_system_info)
     {
@@ -183,6 +236,12 @@ int main(int argc, char *argv[])
             config = parser.parse_file(config_file);
             spdlog::info("Loaded configuration from {}", config_file);
         }
+        catch (const std::invalid_argument &e)
+        {
+            // A valid file selecting unknown kernels is a user error, not a reason to run the defaults
+            spdlog::error("Invalid config file {}: {}", config_file, e.what());
+            return 1;
+        }
         catch (const std::exception &e)
         {
             spdlog::warn("Failed to load config file: {}. Using defaults.",
@@ -197,12 +256,95 @@ int main(int argc, char *argv[])
     }
 
     // Override config with command line arguments
-    config.threads = threads;
+    if (threads_option->count() > 0)
+    {
+        try
+        {
+            auto counts = blas_benchmark::config::parse_thread_spec(threads_str);
+            config.thread_sweep.clear();
+            if (counts.size() == 1 && counts.front() != "physical" && counts.front() != "logical")
+            {
+                config.threads = std::stoi(counts.front());
+            }
+            else
+            {
+                config.thread_sweep = std::move(counts);
+            }
+        }
+        catch (const std::invalid_argument &e)
+        {
+            spdlog::error("Invalid --threads: {}", e.what());
+            return 1;
+        }
+    }
+    if (scaling_option->count() > 0)
+    {
+        try
+        {
+            (void)blas_benchmark::utils::parse_scaling_mode(scaling);
+        }
+        catch (const std::invalid_argument &e)
+        {
+            spdlog::error("Invalid --scaling: {}", e.what());
+            return 1;
+        }
+        config.scaling = scaling;
+    }
+    if (pin_option->count() > 0)
+    {
+        try
+        {
+            (void)blas_benchmark::utils::parse_pin_spec(pin);
+        }
+        catch (const std::invalid_argument &e)
+        {
+            spdlog::error("Invalid --pin: {}", e.what());
+            return 1;
+        }
+        config.pin = pin;
+    }
+    if (instances_option->count() > 0)
+    {
+        if (instances < 1)
+        {
+            spdlog::error("Invalid --instances: {}", instances);
+            return 1;
+        }
+        config.instances = instances;
+    }
     config.cycles = cycles;
     config.warmup = warmup;
+    config.warm_cold = config.warm_cold || warm_cold;
+    config.adaptive = config.adaptive || adaptive;
+    config.perf_counters = config.perf_counters || perf_counters;
+    config.roofline = config.roofline || roofline;
+    config.smt_compare = config.smt_compare || smt_compare;
+    if (precision > 0.0)
+    {
+        config.target_precision = precision;
+    }
     config.output_file = output_file;
     config.format = format;
 
+    if (!seed_str.empty())
+    {
+        // stoull wraps "-1" and stops at trailing junk, so both are rejected here
+        std::size_t pos = 0;
+        try
+        {
+            config.seed = std::stoull(seed_str, &pos);
+        }
+        catch (...)
+        {
+            pos = 0;
+        }
+        if (pos == 0 || pos != seed_str.size() || seed_str.find('-') != std::string::npos)
+        {
+            spdlog::error("Invalid seed: {}", seed_str);
+            return 1;
+        }
+    }
+
     // Parse size arguments
     if (!level1_str.empty())
     {
@@ -259,10 +401,60 @@ int main(int argc, char *argv[])
 
     // Print benchmark configuration
     std::println("=== BLAS Benchmark ===");
-    std::println("Threads:      {}", config.threads);
+    if (config.thread_sweep.empty())
+    {
+        std::println("Threads:      {}", config.threads);
+    }
+    else
+    {
+        std::string counts;
+        for (const auto &count : config.thread_sweep)
+        {
+            counts += (counts.empty() ? "" : ", ") + count;
+        }
+        std::println("Threads:      sweep {} (scaling: {})", counts, config.scaling);
+    }
+    std::println("Pinning:      {}", config.smt_compare ? "physical-only vs SMT siblings" : config.pin);
+    if (config.instances > 1)
+    {
+        std::println("Instances:    {} concurrent", config.instances);
+    }
     std::println("Warmup:       {} iterations", config.warmup);
-    std::println("Cycles:       {} iterations", config.cycles);
-    std::println("Flush Cache:  {}", config.flush_cache ? "Yes" : "No");
+    if (config.adaptive)
+    {
+        std::println("Cycles:       adaptive ({}-{}, target +/-{:.2f}%, budget {:.1f} s)",
+                     config.min_cycles, config.max_cycles, config.target_precision * 100.0,
+                     config.time_budget_sec);
+    }
+    else
+    {
+        std::println("Cycles:       {} iterations", config.cycles);
+    }
+    if (config.warm_cold && (config.flush_cache == "none" || config.flush_cache == "warm"))
+    {
+        // The runner needs a cold primary series and falls back to targeted eviction
+        std::println("Flush Cache:  clflush (warm/cold mode, configured {})", config.flush_cache);
+    }
+    else
+    {
+        std::println("Flush Cache:  {}", config.flush_cache);
+    }
+    if (config.warm_cold)
+    {
+        std::println("Warm/Cold:    Yes");
+    }
+    if (config.perf_counters)
+    {
+        std::println("Perf:         Yes");
+    }
+    if (config.roofline)
+    {
+        std::println("Roofline:     Yes");
+    }
+    if (config.seed.has_value())
+    {
+        std::println("Seed:         {}", config.seed.value());
+    }
 
     if (config.level1_size.has_value())
     {
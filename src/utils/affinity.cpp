@@ -0,0 +1,388 @@
+#include "utils/affinity.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "utils/system_info.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace blas_benchmark::utils
+{
+
+namespace
+{
+
+// CPUs a cpu_set_t can name
+#ifdef __linux__
+constexpr int max_cpus = CPU_SETSIZE;
+#else
+constexpr int max_cpus = 1024;
+#endif
+
+// First line of a sysfs/procfs file, or "" if it cannot be read
+std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+int read_int(const std::string& path, int fallback)
+{
+    try
+    {
+        return std::stoi(read_line(path));
+    }
+    catch (const std::exception&)
+    {
+        return fallback;
+    }
+}
+
+// Physical cores first (smt 0 of every core), then their siblings; packages
+// interleaved so consecutive threads land on different sockets
+std::vector<CpuLocation> scatter_order(const std::vector<CpuLocation>& topology)
+{
+    std::map<int, std::vector<CpuLocation>> packages;
+    for (const auto& location : topology)
+    {
+        packages[location.package].push_back(location);
+    }
+    for (auto& [package, cpus] : packages)
+    {
+        std::sort(cpus.begin(), cpus.end(), [](const CpuLocation& a, const CpuLocation& b) {
+            return std::tie(a.smt, a.core, a.cpu) < std::tie(b.smt, b.core, b.cpu);
+        });
+    }
+
+    std::vector<CpuLocation> order;
+    for (std::size_t i = 0; order.size() < topology.size(); ++i)
+    {
+        for (const auto& [package, cpus] : packages)
+        {
+            if (i < cpus.size())
+            {
+                order.push_back(cpus[i]);
+            }
+        }
+    }
+    return order;
+}
+
+#ifdef __linux__
+cpu_set_t make_cpu_set(const std::vector<int>& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < max_cpus)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return set;
+}
+
+// Thread ids of the process in ascending order: the main thread first, then the
+// others in creation order (as long as tids have not wrapped)
+std::vector<int> process_tids()
+{
+    std::vector<int> tids;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec))
+    {
+        try
+        {
+            tids.push_back(std::stoi(entry.path().filename().string()));
+        }
+        catch (const std::exception&)
+        {
+            // Not a thread entry
+        }
+    }
+    std::sort(tids.begin(), tids.end());
+    return tids;
+}
+#endif
+
+} // anonymous namespace
+
+PinSpec parse_pin_spec(const std::string& spec)
+{
+    if (spec == "none")
+    {
+        return {PinPolicy::none, {}};
+    }
+    if (spec == "compact")
+    {
+        return {PinPolicy::compact, {}};
+    }
+    if (spec == "scatter")
+    {
+        return {PinPolicy::scatter, {}};
+    }
+    if (spec == "physical-only")
+    {
+        return {PinPolicy::physical_only, {}};
+    }
+
+    auto cpus = parse_cpu_list(spec);
+    bool list_chars = std::all_of(spec.begin(), spec.end(), [](char c) {
+        return (c >= '0' && c <= '9') || c == ',' || c == '-' || c == ' ';
+    });
+    if (!list_chars || cpus.empty())
+    {
+        throw std::invalid_argument("Unknown pinning: " + spec +
+                                    " (expected none, compact, scatter, physical-only or a CPU list)");
+    }
+    if (auto beyond = std::find_if(cpus.begin(), cpus.end(), [](int cpu) { return cpu >= max_cpus; });
+        beyond != cpus.end())
+    {
+        throw std::invalid_argument(std::format("Pinning CPU {} is beyond the {} CPUs affinity masks can hold",
+                                                *beyond, max_cpus));
+    }
+    return {PinPolicy::list, std::move(cpus)};
+}
+
+std::string to_string(PinPolicy policy)
+{
+    switch (policy)
+    {
+    case PinPolicy::compact:
+        return "compact";
+    case PinPolicy::scatter:
+        return "scatter";
+    case PinPolicy::physical_only:
+        return "physical-only";
+    case PinPolicy::list:
+        return "list";
+    case PinPolicy::none:
+    default:
+        return "none";
+    }
+}
+
+std::vector<CpuLocation> read_cpu_topology()
+{
+    std::vector<CpuLocation> topology;
+    for (int cpu : parse_cpu_list(read_line("/sys/devices/system/cpu/online")))
+    {
+        const auto dir = std::format("/sys/devices/system/cpu/cpu{}/topology/", cpu);
+        CpuLocation location;
+        location.cpu = cpu;
+        location.package = read_int(dir + "physical_package_id", 0);
+        location.core = read_int(dir + "core_id", cpu);
+        location.siblings = parse_cpu_list(read_line(dir + "thread_siblings_list"));
+        topology.push_back(location);
+    }
+
+    // A core is named by its first hardware thread and the SMT rank is the position in
+    // its sibling list; without the list, CPUs sharing a package and core id are siblings
+    std::map<std::pair<int, int>, std::vector<int>> cores;
+    for (auto& location : topology)
+    {
+        if (location.siblings.empty())
+        {
+            cores[{location.package, location.core}].push_back(location.cpu);
+        }
+    }
+    for (auto& location : topology)
+    {
+        if (location.siblings.empty())
+        {
+            location.siblings = cores[{location.package, location.core}];
+        }
+        std::sort(location.siblings.begin(), location.siblings.end());
+        location.core = location.siblings.front();
+        location.smt = static_cast<int>(
+            std::find(location.siblings.begin(), location.siblings.end(), location.cpu) - location.siblings.begin());
+    }
+    return topology;
+}
+
+bool has_smt_siblings(const std::vector<CpuLocation>& topology)
+{
+    return std::any_of(topology.begin(), topology.end(), [](const CpuLocation& location) {
+        return location.smt > 0;
+    });
+}
+
+std::vector<int> select_cpus(const PinSpec& spec, int threads, const std::vector<CpuLocation>& topology)
+{
+    if (spec.policy == PinPolicy::none)
+    {
+        return {};
+    }
+    if (spec.policy == PinPolicy::list)
+    {
+        // Listed CPUs that are offline or do not exist cannot be pinned to
+        std::vector<int> cpus;
+        for (int cpu : spec.cpus)
+        {
+            if (std::any_of(topology.begin(), topology.end(), [cpu](const CpuLocation& l) { return l.cpu == cpu; }))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    std::vector<CpuLocation> order;
+    if (spec.policy == PinPolicy::scatter)
+    {
+        order = scatter_order(topology);
+    }
+    else
+    {
+        for (const auto& location : topology)
+        {
+            if (spec.policy == PinPolicy::compact || location.smt == 0)
+            {
+                order.push_back(location);
+            }
+        }
+        std::sort(order.begin(), order.end(), [](const CpuLocation& a, const CpuLocation& b) {
+            return std::tie(a.package, a.core, a.smt) < std::tie(b.package, b.core, b.smt);
+        });
+    }
+
+    std::vector<int> cpus;
+    for (const auto& location : order)
+    {
+        if (static_cast<int>(cpus.size()) >= std::max(threads, 1))
+        {
+            break;
+        }
+        cpus.push_back(location.cpu);
+    }
+    return cpus;
+}
+
+bool set_thread_affinity([[maybe_unused]] const std::vector<int>& cpus)
+{
+#ifdef __linux__
+    auto set = make_cpu_set(cpus);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+int set_process_affinity([[maybe_unused]] const std::vector<int>& cpus)
+{
+    int failed = 0;
+#ifdef __linux__
+    auto set = make_cpu_set(cpus);
+    for (int tid : process_tids())
+    {
+        if (sched_setaffinity(tid, sizeof(set), &set) != 0)
+        {
+            ++failed;
+        }
+    }
+#endif
+    return failed;
+}
+
+int pin_process_threads([[maybe_unused]] const std::vector<int>& cpus)
+{
+    int failed = 0;
+#ifdef __linux__
+    if (cpus.empty())
+    {
+        return failed;
+    }
+    const auto tids = process_tids();
+    for (std::size_t i = 0; i < tids.size(); ++i)
+    {
+        auto set = make_cpu_set({cpus[i % cpus.size()]});
+        if (sched_setaffinity(tids[i], sizeof(set), &set) != 0)
+        {
+            ++failed;
+        }
+    }
+#endif
+    return failed;
+}
+
+std::vector<ThreadPlacement> read_thread_placement()
+{
+    std::vector<ThreadPlacement> placement;
+#ifdef __linux__
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec))
+    {
+        ThreadPlacement thread;
+        try
+        {
+            thread.tid = std::stoi(entry.path().filename().string());
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+
+        std::ifstream status(entry.path() / "status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("Cpus_allowed_list:"))
+            {
+                thread.allowed = parse_cpu_list(line.substr(line.find(':') + 1));
+                break;
+            }
+        }
+
+        // stat fields after the parenthesised name start at field 3; processor is field 39
+        auto stat = read_line((entry.path() / "stat").string());
+        std::istringstream fields(stat.substr(stat.rfind(')') + 1));
+        std::string field;
+        for (int index = 3; fields >> field; ++index)
+        {
+            if (index == 39)
+            {
+                thread.last_cpu = std::stoi(field);
+                break;
+            }
+        }
+        placement.push_back(std::move(thread));
+    }
+    std::sort(placement.begin(), placement.end(),
+              [](const ThreadPlacement& a, const ThreadPlacement& b) { return a.tid < b.tid; });
+#endif
+    return placement;
+}
+
+std::string format_cpu_list(std::vector<int> cpus)
+{
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+    std::string list;
+    for (std::size_t i = 0; i < cpus.size();)
+    {
+        std::size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+        {
+            ++j;
+        }
+        list += (list.empty() ? "" : ",") +
+                (j == i ? std::to_string(cpus[i]) : std::format("{}-{}", cpus[i], cpus[j]));
+        i = j + 1;
+    }
+    return list;
+}
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+// How benchmark threads are placed on logical CPUs
+enum class PinPolicy
+{
+    none,          // Leave placement to the OS and OpenBLAS
+    compact,       // Fill the SMT siblings of a core, then the next core, then the next package
+    scatter,       // Round-robin over packages, one thread per core before any SMT sibling
+    physical_only, // One logical CPU per physical core, never two siblings
+    list           // Explicit CPU list
+};
+
+// Pinning request from the config: a policy and, for PinPolicy::list, its CPUs
+struct PinSpec
+{
+    PinPolicy policy{PinPolicy::none};
+    std::vector<int> cpus;
+};
+
+// Parse "none", "compact", "scatter", "physical-only" or a CPU list such as "0,2,4-7";
+// throws std::invalid_argument otherwise, or for CPUs beyond what a cpu_set_t holds
+[[nodiscard]] PinSpec parse_pin_spec(const std::string& spec);
+
+[[nodiscard]] std::string to_string(PinPolicy policy);
+
+// Place of one online logical CPU in the package / core / SMT hierarchy
+struct CpuLocation
+{
+    int cpu{0};
+    int package{0};
+    int core{0};
+    int smt{0};                // Rank among the SMT siblings of its core (0 = first sibling)
+    std::vector<int> siblings; // Hardware threads of its physical core, itself included
+};
+
+// Online CPUs with their package, core and SMT siblings from /sys/devices/system/cpu
+// (core ids can repeat across dies, so cores are told apart by thread_siblings_list)
+[[nodiscard]] std::vector<CpuLocation> read_cpu_topology();
+
+// True if some physical core has more than one online hardware thread
+[[nodiscard]] bool has_smt_siblings(const std::vector<CpuLocation>& topology);
+
+// CPUs for `threads` threads under `spec`, in placement order; all qualifying CPUs
+// when there are fewer than `threads`, the online CPUs of the explicit list for
+// PinPolicy::list and nothing for PinPolicy::none
+[[nodiscard]] std::vector<int> select_cpus(const PinSpec& spec, int threads,
+                                           const std::vector<CpuLocation>& topology);
+
+// Restrict the calling thread to `cpus`; threads it creates later inherit the set
+bool set_thread_affinity(const std::vector<int>& cpus);
+
+// Restrict every existing thread of the process (the OpenBLAS pool included) to `cpus`;
+// returns how many threads could not be restricted
+int set_process_affinity(const std::vector<int>& cpus);
+
+// Pin the existing threads one per CPU: the i-th thread in tid order (the main thread,
+// then the OpenBLAS workers as they were created) to cpus[i % cpus.size()];
+// returns how many threads could not be pinned
+int pin_process_threads(const std::vector<int>& cpus);
+
+// Where one thread of the process may run and where it last ran
+struct ThreadPlacement
+{
+    int tid{0};
+    std::vector<int> allowed; // Cpus_allowed_list
+    int last_cpu{-1};         // processor field of the thread's stat
+};
+
+// Placement of every thread of the process in tid order, read from /proc/self/task
+[[nodiscard]] std::vector<ThreadPlacement> read_thread_placement();
+
+// Compact "0-3,8" form of a CPU list (the inverse of parse_cpu_list)
+[[nodiscard]] std::string format_cpu_list(std::vector<int> cpus);
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,398 @@
+#include "utils/cache_flusher.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#include "utils/affinity.h"
+#include "utils/system_info.h"
+#include "utils/timer.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace blas_benchmark::utils
+{
+
+namespace
+{
+
+// Evict with a buffer this many times larger than the cache
+constexpr std::size_t size_multiplier = 4;
+
+constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+constexpr std::size_t cache_line_size = 64;
+constexpr std::size_t cache_line_doubles = cache_line_size / sizeof(double);
+
+// Sink for touch() so the reads are not optimized away
+volatile unsigned char touch_sink = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+// clflushopt (CPUID.(EAX=7,ECX=0):EBX[23]) is weakly ordered and much faster than clflush
+bool has_clflushopt()
+{
+    static const bool supported = []() {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0)
+        {
+            return false;
+        }
+        return (ebx & (1U << 23)) != 0;
+    }();
+    return supported;
+}
+#endif
+
+#ifdef __linux__
+// Apply a memory policy to a mapping without depending on libnuma
+bool bind_memory(void* addr, std::size_t bytes, int mode, const std::vector<int>& nodes)
+{
+    constexpr std::size_t mask_bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(4, 0);
+    for (int node : nodes)
+    {
+        auto bit = static_cast<std::size_t>(node);
+        if (bit >= mask.size() * mask_bits)
+        {
+            mask.resize(bit / mask_bits + 1, 0);
+        }
+        mask[bit / mask_bits] |= 1UL << (bit % mask_bits);
+    }
+    return syscall(SYS_mbind, addr, bytes, mode, mask.data(), mask.size() * mask_bits, 0) == 0;
+}
+#endif
+
+} // anonymous namespace
+
+FlushMode parse_flush_mode(const std::string& name)
+{
+    if (name == "none")
+    {
+        return FlushMode::none;
+    }
+    if (name == "warm")
+    {
+        return FlushMode::warm;
+    }
+    if (name == "sweep")
+    {
+        return FlushMode::sweep;
+    }
+    if (name == "clflush")
+    {
+        return FlushMode::clflush;
+    }
+    throw std::invalid_argument("Unknown flush mode: " + name +
+                                " (expected sweep, clflush, none or warm)");
+}
+
+std::string to_string(FlushMode mode)
+{
+    switch (mode)
+    {
+    case FlushMode::none:
+        return "none";
+    case FlushMode::warm:
+        return "warm";
+    case FlushMode::clflush:
+        return "clflush";
+    case FlushMode::sweep:
+    default:
+        return "sweep";
+    }
+}
+
+NumaPlacement parse_numa_placement(const std::string& name)
+{
+    if (name == "local")
+    {
+        return NumaPlacement::local;
+    }
+    if (name == "interleave")
+    {
+        return NumaPlacement::interleave;
+    }
+    if (name == "per-node")
+    {
+        return NumaPlacement::per_node;
+    }
+    throw std::invalid_argument("Unknown flush NUMA placement: " + name +
+                                " (expected local, interleave or per-node)");
+}
+
+std::string to_string(NumaPlacement placement)
+{
+    switch (placement)
+    {
+    case NumaPlacement::interleave:
+        return "interleave";
+    case NumaPlacement::per_node:
+        return "per-node";
+    case NumaPlacement::local:
+    default:
+        return "local";
+    }
+}
+
+CacheFlusher::CacheFlusher(std::size_t cache_size_bytes, CacheFlusherOptions options)
+    : m_options(options)
+{
+#if !defined(__x86_64__) && !defined(__i386__) && !defined(__aarch64__)
+    if (m_options.mode == FlushMode::clflush)
+    {
+        throw std::invalid_argument("clflush mode is not supported on this architecture");
+    }
+#endif
+
+    if (m_options.mode != FlushMode::sweep)
+    {
+        spdlog::info("Cache flush mode: {}", to_string(m_options.mode));
+        return;
+    }
+
+    std::size_t bytes = cache_size_bytes * size_multiplier;
+    auto nodes = SystemInfoCollector().get_numa_nodes();
+
+    if (m_options.numa == NumaPlacement::per_node && nodes.size() > 1)
+    {
+        // Each socket has its own LLC, so each node gets its own buffer and sweeper
+        for (const auto& node : nodes)
+        {
+            m_regions.push_back(map_region(bytes, node.id, node.cpus));
+        }
+    }
+    else
+    {
+        Region region = map_region(bytes, -1, {});
+#ifdef __linux__
+        if (m_options.numa == NumaPlacement::interleave && nodes.size() > 1)
+        {
+            std::vector<int> ids;
+            for (const auto& node : nodes)
+            {
+                ids.push_back(node.id);
+            }
+            if (!bind_memory(region.data, region.bytes, MPOL_INTERLEAVE, ids))
+            {
+                spdlog::warn("Failed to interleave cache flush buffer across NUMA nodes");
+            }
+        }
+#endif
+        m_regions.push_back(region);
+    }
+
+    // Pre-fault every page now, from the thread that will sweep it
+    for (const auto& region : m_regions)
+    {
+        if (region.cpus.empty())
+        {
+            std::memset(region.data, 0, region.bytes);
+            continue;
+        }
+        std::thread([&region]() {
+            (void)set_thread_affinity(region.cpus);
+            std::memset(region.data, 0, region.bytes);
+        }).join();
+    }
+
+    spdlog::info("Cache flush buffer: {} MB in {} region(s), placement {}, huge pages {}",
+                 buffer_bytes() / (1024 * 1024), m_regions.size(),
+                 to_string(m_options.numa), m_options.huge_pages ? "on" : "off");
+}
+
+CacheFlusher::~CacheFlusher()
+{
+    for (const auto& region : m_regions)
+    {
+#ifdef __linux__
+        munmap(region.data, region.bytes);
+#else
+        ::operator delete(region.data);
+#endif
+    }
+}
+
+CacheFlusher::Region CacheFlusher::map_region(std::size_t bytes, int node, std::vector<int> cpus) const
+{
+    Region region;
+    region.node = node;
+    region.cpus = std::move(cpus);
+
+#ifdef __linux__
+    bytes = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    void* addr = MAP_FAILED;
+
+    if (m_options.huge_pages)
+    {
+        addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr == MAP_FAILED)
+        {
+            spdlog::debug("MAP_HUGETLB unavailable, falling back to transparent huge pages");
+        }
+    }
+
+    if (addr == MAP_FAILED)
+    {
+        addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot allocate cache flush buffer");
+        }
+        madvise(addr, bytes, m_options.huge_pages ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+    }
+
+    if (node >= 0 && !bind_memory(addr, bytes, MPOL_BIND, {node}))
+    {
+        spdlog::warn("Failed to bind cache flush buffer to NUMA node {}", node);
+    }
+
+    region.data = static_cast<double*>(addr);
+#else
+    region.data = static_cast<double*>(::operator new(bytes));
+#endif
+    region.bytes = bytes;
+    return region;
+}
+
+void CacheFlusher::sweep(const Region& region)
+{
+    // Read-modify-write one element per cache line: independent iterations keep
+    // many misses in flight, and dirtying every line also forces modified
+    // operand lines out of the cache
+    std::size_t count = region.bytes / sizeof(double);
+    for (std::size_t i = 0; i < count; i += cache_line_doubles)
+    {
+        region.data[i] += 1.0;
+    }
+}
+
+void CacheFlusher::prepare(const std::vector<MemoryRegion>& operands)
+{
+    Timer timer;
+    timer.start();
+
+    switch (m_options.mode)
+    {
+    case FlushMode::sweep:
+        flush();
+        break;
+    case FlushMode::clflush:
+        evict(operands);
+        break;
+    case FlushMode::warm:
+        touch(operands);
+        break;
+    case FlushMode::none:
+        break;
+    }
+
+    timer.stop();
+    m_total_flush_ms += timer.elapsed_ms();
+    ++m_flush_count;
+}
+
+void CacheFlusher::evict(const std::vector<MemoryRegion>& regions)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    const bool use_clflushopt = has_clflushopt();
+#endif
+
+    for (const auto& region : regions)
+    {
+        // Align down so the first partial line is flushed as well
+        auto begin = reinterpret_cast<std::uintptr_t>(region.data) & ~(cache_line_size - 1);
+        auto end = reinterpret_cast<std::uintptr_t>(region.data) + region.bytes;
+
+        for (std::uintptr_t line = begin; line < end; line += cache_line_size)
+        {
+            const auto* ptr = reinterpret_cast<const char*>(line);
+#if defined(__x86_64__) || defined(__i386__)
+            if (use_clflushopt)
+            {
+                asm volatile("clflushopt %0" : : "m"(*ptr));
+            }
+            else
+            {
+                _mm_clflush(ptr);
+            }
+#elif defined(__aarch64__)
+            asm volatile("dc civac, %0" : : "r"(ptr) : "memory");
+#else
+            (void)ptr;
+#endif
+        }
+    }
+
+    // Make sure every eviction completed before the timer starts
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_mfence();
+#elif defined(__aarch64__)
+    asm volatile("dsb ish" : : : "memory");
+#endif
+}
+
+void CacheFlusher::touch(const std::vector<MemoryRegion>& regions)
+{
+    unsigned char sum = 0;
+    for (const auto& region : regions)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(region.data);
+        for (std::size_t i = 0; i < region.bytes; i += cache_line_size)
+        {
+            sum ^= bytes[i];
+        }
+    }
+    touch_sink = sum;
+}
+
+void CacheFlusher::flush()
+{
+    if (m_regions.size() == 1 && m_regions.front().cpus.empty())
+    {
+        sweep(m_regions.front());
+    }
+    else
+    {
+        std::vector<std::thread> sweepers;
+        sweepers.reserve(m_regions.size());
+        for (const auto& region : m_regions)
+        {
+            sweepers.emplace_back([&region]() {
+                (void)set_thread_affinity(region.cpus);
+                sweep(region);
+            });
+        }
+        for (auto& sweeper : sweepers)
+        {
+            sweeper.join();
+        }
+    }
+}
+
+std::size_t CacheFlusher::buffer_bytes() const
+{
+    std::size_t total = 0;
+    for (const auto& region : m_regions)
+    {
+        total += region.bytes;
+    }
+    return total;
+}
+
+} // namespace blas_benchmark::utils
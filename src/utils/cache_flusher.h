@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+// Cache state to establish before each warmup and timed call
+enum class FlushMode
+{
+    none,   // Leave caches as the previous call left them
+    warm,   // Read every operand line so the call starts with hot caches
+    sweep,  // Sweep a buffer larger than the LLC (indirect eviction)
+    clflush // Evict exactly the operand lines with clflushopt/clflush + fence
+};
+
+// Parse "none", "warm", "sweep" or "clflush"; throws std::invalid_argument otherwise
+[[nodiscard]] FlushMode parse_flush_mode(const std::string& name);
+
+[[nodiscard]] std::string to_string(FlushMode mode);
+
+// Contiguous memory touched by a benchmark kernel
+struct MemoryRegion
+{
+    const void* data{nullptr};
+    std::size_t bytes{0};
+};
+
+// Where the eviction buffer lives on multi-socket systems
+enum class NumaPlacement
+{
+    local,      // First-touch by the calling thread (evicts the local LLC only)
+    interleave, // Pages interleaved across all nodes, swept by the calling thread
+    per_node    // One buffer bound to each node, swept by a thread pinned to that node
+};
+
+// Parse "local", "interleave" or "per-node"; throws std::invalid_argument otherwise
+[[nodiscard]] NumaPlacement parse_numa_placement(const std::string& name);
+
+[[nodiscard]] std::string to_string(NumaPlacement placement);
+
+// Cache flusher options
+struct CacheFlusherOptions
+{
+    FlushMode mode{FlushMode::sweep};
+    bool huge_pages{false}; // Back the sweep buffer with huge pages (explicit, then THP fallback)
+    NumaPlacement numa{NumaPlacement::local};
+};
+
+// Puts CPU caches into a known state before each benchmark call
+// In sweep mode the eviction buffer is allocated and pre-faulted once and reused
+// by every flush, so no allocator, zero-fill or page-fault noise lands right
+// before a timed call; the other modes need no buffer at all
+class CacheFlusher
+{
+public:
+    explicit CacheFlusher(std::size_t cache_size_bytes, CacheFlusherOptions options = {});
+    ~CacheFlusher();
+
+    CacheFlusher(const CacheFlusher&) = delete;
+    CacheFlusher& operator=(const CacheFlusher&) = delete;
+
+    // Establish the configured cache state for a call touching the given operands
+    // Time spent is accumulated separately from the measured time
+    void prepare(const std::vector<MemoryRegion>& operands);
+
+    // Sweep the eviction buffer(s), regardless of mode
+    void flush();
+
+    // Evict every cache line of the given regions, followed by a fence
+    static void evict(const std::vector<MemoryRegion>& regions);
+
+    // Read every cache line of the given regions
+    static void touch(const std::vector<MemoryRegion>& regions);
+
+    // Total time spent in prepare() since construction or the last reset
+    [[nodiscard]] double total_flush_ms() const
+    {
+        return m_total_flush_ms;
+    }
+
+    // Number of prepare() calls since construction or the last reset
+    [[nodiscard]] std::size_t flush_count() const
+    {
+        return m_flush_count;
+    }
+
+    // Reset flush time and count, e.g. at the start of each benchmark
+    void reset_stats()
+    {
+        m_total_flush_ms = 0.0;
+        m_flush_count = 0;
+    }
+
+    // Total size of all eviction buffers in bytes
+    [[nodiscard]] std::size_t buffer_bytes() const;
+
+    [[nodiscard]] const CacheFlusherOptions& options() const
+    {
+        return m_options;
+    }
+
+private:
+    // One mapped eviction buffer, optionally bound to a NUMA node
+    struct Region
+    {
+        double* data{nullptr};
+        std::size_t bytes{0};
+        int node{-1};
+        std::vector<int> cpus; // CPUs to sweep from; empty means the calling thread
+    };
+
+    CacheFlusherOptions m_options;
+    std::vector<Region> m_regions;
+    double m_total_flush_ms{0.0};
+    std::size_t m_flush_count{0};
+
+    [[nodiscard]] Region map_region(std::size_t bytes, int node, std::vector<int> cpus) const;
+    static void sweep(const Region& region);
+};
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,345 @@
+#include "utils/perf_counters.h"
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace blas_benchmark::utils
+{
+
+namespace
+{
+
+#ifdef __linux__
+// One event of a counter group: perf type and config
+struct EventSpec
+{
+    PerfEvent event;
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t hw_cache_config(std::uint64_t cache, std::uint64_t op, std::uint64_t result)
+{
+    return cache | (op << 8) | (result << 16);
+}
+
+// FP_ARITH_INST_RETIRED (event 0xC7); each umask pair covers double and single
+constexpr std::uint64_t fp_arith_config(std::uint64_t umask)
+{
+    return 0xC7 | (umask << 8);
+}
+
+bool is_intel()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(0, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return false;
+    }
+    char vendor[13] = {};
+    std::memcpy(vendor, &ebx, 4);
+    std::memcpy(vendor + 4, &edx, 4);
+    std::memcpy(vendor + 8, &ecx, 4);
+    return std::strcmp(vendor, "GenuineIntel") == 0;
+#else
+    return false;
+#endif
+}
+
+// Memory group and FP group, both led by cycles
+std::vector<std::vector<EventSpec>> event_groups()
+{
+    std::vector<std::vector<EventSpec>> groups;
+
+    groups.push_back({
+        {PerfEvent::cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PerfEvent::instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PerfEvent::llc_loads, PERF_TYPE_HW_CACHE,
+         hw_cache_config(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+        {PerfEvent::llc_misses, PERF_TYPE_HW_CACHE,
+         hw_cache_config(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+        {PerfEvent::dtlb_loads, PERF_TYPE_HW_CACHE,
+         hw_cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+        {PerfEvent::dtlb_misses, PERF_TYPE_HW_CACHE,
+         hw_cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    });
+
+    // Raw FP_ARITH events only exist on Intel cores (Broadwell and later)
+    if (is_intel())
+    {
+        groups.push_back({
+            {PerfEvent::cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PerfEvent::fp_scalar, PERF_TYPE_RAW, fp_arith_config(0x03)},
+            {PerfEvent::fp_128, PERF_TYPE_RAW, fp_arith_config(0x0C)},
+            {PerfEvent::fp_256, PERF_TYPE_RAW, fp_arith_config(0x30)},
+            {PerfEvent::fp_512, PERF_TYPE_RAW, fp_arith_config(0xC0)},
+        });
+    }
+
+    return groups;
+}
+
+int perf_event_open(const EventSpec& spec, int tid, int group_fd)
+{
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = spec.type;
+    attr.config = spec.config;
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, group_fd, 0));
+}
+#endif
+
+} // anonymous namespace
+
+std::string to_string(PerfEvent event)
+{
+    switch (event)
+    {
+    case PerfEvent::cycles:
+        return "cycles";
+    case PerfEvent::instructions:
+        return "instructions";
+    case PerfEvent::llc_loads:
+        return "llc-loads";
+    case PerfEvent::llc_misses:
+        return "llc-misses";
+    case PerfEvent::dtlb_loads:
+        return "dtlb-loads";
+    case PerfEvent::dtlb_misses:
+        return "dtlb-misses";
+    case PerfEvent::fp_scalar:
+        return "fp-scalar";
+    case PerfEvent::fp_128:
+        return "fp-128";
+    case PerfEvent::fp_256:
+        return "fp-256";
+    case PerfEvent::fp_512:
+        return "fp-512";
+    case PerfEvent::count:
+    default:
+        return "unknown";
+    }
+}
+
+PerfCounts PerfCounts::scaled(double divisor) const
+{
+    PerfCounts result = *this;
+    if (divisor > 0.0)
+    {
+        for (auto& value : result.values)
+        {
+            value /= divisor;
+        }
+    }
+    return result;
+}
+
+double PerfCounts::ipc() const
+{
+    if (!has(PerfEvent::cycles) || !has(PerfEvent::instructions) || get(PerfEvent::cycles) <= 0.0)
+    {
+        return 0.0;
+    }
+    return get(PerfEvent::instructions) / get(PerfEvent::cycles);
+}
+
+double PerfCounts::llc_miss_rate() const
+{
+    if (!has(PerfEvent::llc_loads) || !has(PerfEvent::llc_misses) || get(PerfEvent::llc_loads) <= 0.0)
+    {
+        return 0.0;
+    }
+    return get(PerfEvent::llc_misses) / get(PerfEvent::llc_loads);
+}
+
+double PerfCounts::dtlb_miss_rate() const
+{
+    if (!has(PerfEvent::dtlb_loads) || !has(PerfEvent::dtlb_misses) || get(PerfEvent::dtlb_loads) <= 0.0)
+    {
+        return 0.0;
+    }
+    return get(PerfEvent::dtlb_misses) / get(PerfEvent::dtlb_loads);
+}
+
+double PerfCounts::vector_width_bits(std::size_t scalar_bits) const
+{
+    const std::array<std::pair<PerfEvent, double>, 4> widths = {{
+        {PerfEvent::fp_scalar, static_cast<double>(scalar_bits)},
+        {PerfEvent::fp_128, 128.0},
+        {PerfEvent::fp_256, 256.0},
+        {PerfEvent::fp_512, 512.0},
+    }};
+
+    double instructions = 0.0;
+    double bits = 0.0;
+    for (const auto& [event, width] : widths)
+    {
+        if (has(event))
+        {
+            instructions += get(event);
+            bits += get(event) * width;
+        }
+    }
+    return instructions > 0.0 ? bits / instructions : 0.0;
+}
+
+PerfCounters::PerfCounters()
+{
+#ifdef __linux__
+    // Every thread that exists now, including the OpenBLAS worker pool
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec))
+    {
+        try
+        {
+            open_thread(std::stoi(entry.path().filename().string()));
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+    }
+    if (ec)
+    {
+        m_error = "cannot list /proc/self/task";
+    }
+#else
+    m_error = "perf_event_open is Linux-only";
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (const auto& group : m_groups)
+    {
+        for (const auto& counter : group.counters)
+        {
+            close(counter.fd);
+        }
+    }
+#endif
+}
+
+void PerfCounters::open_thread([[maybe_unused]] int tid)
+{
+#ifdef __linux__
+    auto groups = event_groups();
+    for (std::size_t g = 0; g < groups.size(); ++g)
+    {
+        const auto& specs = groups[g];
+        Group group;
+        group.counts_cycles = g == 0;
+        group.leader_fd = perf_event_open(specs.front(), tid, -1);
+        if (group.leader_fd < 0)
+        {
+            if (m_error.empty())
+            {
+                m_error = std::format("{}: {}", to_string(specs.front().event), std::strerror(errno));
+            }
+            continue;
+        }
+        group.counters.push_back({group.leader_fd, specs.front().event});
+
+        for (std::size_t i = 1; i < specs.size(); ++i)
+        {
+            int fd = perf_event_open(specs[i], tid, group.leader_fd);
+            if (fd < 0)
+            {
+                spdlog::debug("perf event {} unavailable on thread {}: {}",
+                              to_string(specs[i].event), tid, std::strerror(errno));
+                continue;
+            }
+            group.counters.push_back({fd, specs[i].event});
+        }
+
+        m_groups.push_back(std::move(group));
+    }
+#endif
+}
+
+void PerfCounters::reset()
+{
+#ifdef __linux__
+    for (const auto& group : m_groups)
+    {
+        ioctl(group.leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+void PerfCounters::enable()
+{
+#ifdef __linux__
+    for (const auto& group : m_groups)
+    {
+        ioctl(group.leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+void PerfCounters::disable()
+{
+#ifdef __linux__
+    for (const auto& group : m_groups)
+    {
+        ioctl(group.leader_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+PerfCounts PerfCounters::read() const
+{
+    PerfCounts counts;
+#ifdef __linux__
+    for (const auto& group : m_groups)
+    {
+        for (const auto& counter : group.counters)
+        {
+            // Every group is led by cycles; sum only one copy per thread
+            if (counter.event == PerfEvent::cycles && !group.counts_cycles)
+            {
+                continue;
+            }
+
+            std::uint64_t data[3] = {}; // value, time_enabled, time_running
+            if (::read(counter.fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+            {
+                continue;
+            }
+
+            auto index = static_cast<std::size_t>(counter.event);
+            double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            counts.values[index] += static_cast<double>(data[0]) * scale;
+            counts.valid[index] = true;
+        }
+    }
+#endif
+    return counts;
+}
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+// Hardware events counted around the timed kernel calls
+enum class PerfEvent
+{
+    cycles,
+    instructions,
+    llc_loads,
+    llc_misses,
+    dtlb_loads,
+    dtlb_misses,
+    fp_scalar,  // FP_ARITH_INST_RETIRED.SCALAR_* (Intel only)
+    fp_128,     // FP_ARITH_INST_RETIRED.128B_PACKED_*
+    fp_256,     // FP_ARITH_INST_RETIRED.256B_PACKED_*
+    fp_512,     // FP_ARITH_INST_RETIRED.512B_PACKED_*
+    count
+};
+
+inline constexpr std::size_t perf_event_count = static_cast<std::size_t>(PerfEvent::count);
+
+[[nodiscard]] std::string to_string(PerfEvent event);
+
+// Event totals summed over all threads, scaled for multiplexing
+struct PerfCounts
+{
+    std::array<double, perf_event_count> values{};
+    std::array<bool, perf_event_count> valid{};
+
+    [[nodiscard]] bool has(PerfEvent event) const
+    {
+        return valid[static_cast<std::size_t>(event)];
+    }
+
+    [[nodiscard]] double get(PerfEvent event) const
+    {
+        return values[static_cast<std::size_t>(event)];
+    }
+
+    // Divide every count, e.g. by the number of calls
+    [[nodiscard]] PerfCounts scaled(double divisor) const;
+
+    // Derived metrics; 0 when an input event is missing
+    [[nodiscard]] double ipc() const;
+    [[nodiscard]] double llc_miss_rate() const;
+    [[nodiscard]] double dtlb_miss_rate() const;
+
+    // Average FP instruction width in bits; scalar ops count as `scalar_bits` wide
+    [[nodiscard]] double vector_width_bits(std::size_t scalar_bits) const;
+};
+
+// perf_event_open counters for every thread of the process
+// Counters are opened per existing thread (so OpenBLAS worker threads are
+// included) and split into two groups, memory and FP, each led by cycles, so
+// neither exceeds the general-purpose counters of a core; groups multiplex and
+// counts are scaled by time_enabled / time_running. Events the PMU does not
+// support are skipped; available() is false if nothing could be opened.
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    [[nodiscard]] bool available() const
+    {
+        return !m_groups.empty();
+    }
+
+    // Why nothing could be opened, if available() is false
+    [[nodiscard]] const std::string& error() const
+    {
+        return m_error;
+    }
+
+    void reset();
+    void enable();
+    void disable();
+
+    // Totals since the last reset
+    [[nodiscard]] PerfCounts read() const;
+
+private:
+    struct Counter
+    {
+        int fd{-1};
+        PerfEvent event{PerfEvent::cycles};
+    };
+
+    struct Group
+    {
+        int leader_fd{-1};
+        std::vector<Counter> counters; // Includes the leader
+        bool counts_cycles{false};     // Only one group per thread contributes cycles
+    };
+
+    void open_thread(int tid);
+
+    std::vector<Group> m_groups;
+    std::string m_error;
+};
+
+} // namespace blas_benchmark::utils
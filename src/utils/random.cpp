@@ -0,0 +1,139 @@
+#include "utils/random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+namespace
+{
+
+// Elements per work block; fixed so results never depend on the thread count
+constexpr std::size_t block_size = 64 * 1024;
+
+// Below this size spawning threads costs more than it saves
+constexpr std::size_t parallel_threshold = 4 * block_size;
+
+// Bit pattern of an element, widened to 64 bits
+template<typename T>
+std::uint64_t element_bits(T value)
+{
+    if constexpr (sizeof(T) == sizeof(std::uint32_t))
+    {
+        return std::bit_cast<std::uint32_t>(value);
+    }
+    else
+    {
+        return std::bit_cast<std::uint64_t>(value);
+    }
+}
+
+template<typename T>
+std::uint64_t checksum_block(const T* data, std::size_t begin, std::size_t end)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        sum += CounterRng::hash(element_bits(data[i]), i);
+    }
+    return sum;
+}
+
+template<typename T>
+std::uint64_t fill_block(T* data, std::size_t begin, std::size_t end, const CounterRng& rng, T min_val, T range)
+{
+    // No loop-carried state: every element is a pure function of its index
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            data[i] = min_val + range * CounterRng::to_unit_float(rng(i));
+        }
+        else
+        {
+            data[i] = min_val + range * static_cast<T>(CounterRng::to_unit_double(rng(i)));
+        }
+    }
+    return checksum_block(data, begin, end);
+}
+
+// Run block_func(begin, end) over all blocks of a buffer on every hardware thread
+// and return the wrapping sum of the per-block results
+template<typename BlockFunc>
+std::uint64_t for_each_block(std::size_t size, BlockFunc&& block_func)
+{
+    const std::size_t num_blocks = (size + block_size - 1) / block_size;
+    std::atomic<std::size_t> next_block{0};
+    std::atomic<std::uint64_t> total{0};
+
+    auto run_blocks = [&]()
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t block = next_block++; block < num_blocks; block = next_block++)
+        {
+            std::size_t begin = block * block_size;
+            std::size_t end = std::min(begin + block_size, size);
+            sum += block_func(begin, end);
+        }
+        total += sum;
+    };
+
+    std::size_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, num_blocks);
+
+    if (size < parallel_threshold || num_threads <= 1)
+    {
+        run_blocks();
+        return total;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (std::size_t t = 1; t < num_threads; ++t)
+    {
+        workers.emplace_back(run_blocks);
+    }
+    run_blocks();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return total;
+}
+
+} // anonymous namespace
+
+template<typename T>
+std::uint64_t fill_uniform(T* data, std::size_t size, std::uint64_t seed, T min_val, T max_val)
+{
+    const CounterRng rng(seed);
+    const T range = max_val - min_val;
+
+    return for_each_block(size, [&](std::size_t begin, std::size_t end) {
+        return fill_block(data, begin, end, rng, min_val, range);
+    });
+}
+
+template<typename T>
+std::uint64_t checksum(const T* data, std::size_t size)
+{
+    return for_each_block(size, [&](std::size_t begin, std::size_t end) {
+        return checksum_block(data, begin, end);
+    });
+}
+
+// Explicit template instantiation
+template std::uint64_t fill_uniform<double>(double* data, std::size_t size, std::uint64_t seed,
+                                            double min_val, double max_val);
+template std::uint64_t fill_uniform<float>(float* data, std::size_t size, std::uint64_t seed,
+                                           float min_val, float max_val);
+template std::uint64_t checksum<double>(const double* data, std::size_t size);
+template std::uint64_t checksum<float>(const float* data, std::size_t size);
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace blas_benchmark::utils
+{
+
+// Counter-based random number generator (SplitMix64 finalizer over a Weyl sequence)
+// Value i of a stream depends only on (seed, i), so any element can be produced
+// without generating the ones before it. This gives free jump-ahead and lets
+// large buffers be filled in parallel with bit-identical results.
+class CounterRng
+{
+public:
+    explicit constexpr CounterRng(std::uint64_t seed)
+        : m_key(mix(seed))
+    {
+    }
+
+    // Get the 64-bit random value at position counter
+    [[nodiscard]] constexpr std::uint64_t operator()(std::uint64_t counter) const
+    {
+        return mix(m_key + (counter + 1) * golden_gamma);
+    }
+
+    // Hash a (value bits, position) pair for checksums
+    [[nodiscard]] static constexpr std::uint64_t hash(std::uint64_t bits, std::uint64_t counter)
+    {
+        return mix(bits ^ (counter * golden_gamma));
+    }
+
+    // Map a random value to [0, 1) using the top mantissa bits
+    // Built with integer ops and a bit cast so the fill loop vectorizes
+    [[nodiscard]] static constexpr double to_unit_double(std::uint64_t bits)
+    {
+        return std::bit_cast<double>((bits >> 12) | 0x3FF0000000000000ULL) - 1.0;
+    }
+
+    [[nodiscard]] static constexpr float to_unit_float(std::uint64_t bits)
+    {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(bits >> 41) | 0x3F800000U) - 1.0F;
+    }
+
+private:
+    static constexpr std::uint64_t golden_gamma = 0x9E3779B97F4A7C15ULL;
+
+    static constexpr std::uint64_t mix(std::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    std::uint64_t m_key;
+};
+
+// Fill a buffer with uniform values in [min_val, max_val) and return its checksum
+// Work is split into fixed-size blocks shared across all hardware threads;
+// block boundaries do not depend on the thread count, so output is
+// bit-identical for a given seed however many threads run
+template<typename T>
+std::uint64_t fill_uniform(T* data, std::size_t size, std::uint64_t seed, T min_val, T max_val);
+
+// Allocator whose default construction of trivially copyable elements writes nothing,
+// so a std::vector<T, UninitializedAllocator<T>>(n) leaves its pages untouched and the
+// parallel fill_uniform is the first to write (and so NUMA-place) each of them.
+// Every element must be written before it is read
+template<typename T>
+struct UninitializedAllocator : std::allocator<T>
+{
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = UninitializedAllocator<U>;
+    };
+
+    UninitializedAllocator() = default;
+
+    template<typename U>
+    constexpr UninitializedAllocator(const UninitializedAllocator<U>&) noexcept
+    {
+    }
+
+    template<typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        if constexpr (!std::is_trivially_copyable_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U();
+        }
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+// Checksum of a buffer's bit patterns, identical to the one fill_uniform returns
+// Order-independent sum of per-element hashes, so it can be accumulated per block
+template<typename T>
+[[nodiscard]] std::uint64_t checksum(const T* data, std::size_t size);
+
+} // namespace blas_benchmark::utils
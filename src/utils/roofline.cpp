@@ -0,0 +1,256 @@
+#include "utils/roofline.h"
+
+#include <algorithm>
+#include <functional>
+#include <latch>
+#include <thread>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "utils/affinity.h"
+#include "utils/timer.h"
+
+namespace blas_benchmark::utils
+{
+
+namespace
+{
+
+// Native SIMD register width, so the microkernel uses full vectors
+#if defined(__AVX512F__)
+constexpr std::size_t simd_bytes = 64;
+constexpr std::size_t fma_chains = 12; // 2 FMA ports x 4-cycle latency, plus slack
+#elif defined(__AVX__)
+constexpr std::size_t simd_bytes = 32;
+constexpr std::size_t fma_chains = 10;
+#else
+constexpr std::size_t simd_bytes = 16;
+constexpr std::size_t fma_chains = 8;
+#endif
+
+template<typename T>
+struct Simd
+{
+    typedef T type __attribute__((vector_size(simd_bytes)));
+    static constexpr std::size_t lanes = simd_bytes / sizeof(T);
+};
+
+constexpr double min_measure_ms = 50.0;
+constexpr int trials = 3;
+
+// Run `work(thread_index)` on `threads` threads released together, one per CPU of
+// `cpus` when given; returns wall ms
+double run_parallel(int threads, const std::vector<int>& cpus, const std::function<void(int)>& work)
+{
+    std::latch start(threads + 1);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&start, &work, &cpus, t]() {
+            if (!cpus.empty())
+            {
+                (void)set_thread_affinity({cpus[static_cast<std::size_t>(t) % cpus.size()]});
+            }
+            start.arrive_and_wait();
+            work(t);
+        });
+    }
+
+    Timer timer;
+    start.arrive_and_wait();
+    timer.start();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    timer.stop();
+    return timer.elapsed_ms();
+}
+
+// Independent multiply-add chains that stay in registers; with -ffast-math or
+// -ffp-contract=fast each update is one FMA per vector
+template<typename T>
+T fma_kernel(std::size_t iterations)
+{
+    using V = typename Simd<T>::type;
+    V acc[fma_chains];
+    for (std::size_t j = 0; j < fma_chains; ++j)
+    {
+        acc[j] = V{} + static_cast<T>(j);
+    }
+    const V mul = V{} + static_cast<T>(0.999999);
+    const V add = V{} + static_cast<T>(1e-6);
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < fma_chains; ++j)
+        {
+            acc[j] = acc[j] * mul + add;
+        }
+    }
+
+    T sum = 0;
+    for (std::size_t j = 0; j < fma_chains; ++j)
+    {
+        for (std::size_t l = 0; l < Simd<T>::lanes; ++l)
+        {
+            sum += acc[j][l];
+        }
+    }
+    return sum;
+}
+
+template<typename T>
+double measure_peak_gflops(int threads, const std::vector<int>& cpus)
+{
+    std::vector<T> sinks(threads);
+    std::size_t iterations = 1 << 16;
+    double best = 0.0;
+
+    for (int trial = 0; trial < trials; ++trial)
+    {
+        double ms = 0.0;
+        do
+        {
+            ms = run_parallel(threads, cpus, [&](int t) { sinks[t] = fma_kernel<T>(iterations); });
+            if (ms < min_measure_ms)
+            {
+                iterations *= 2;
+            }
+        } while (ms < min_measure_ms);
+
+        double flops = 2.0 * static_cast<double>(iterations) * fma_chains * Simd<T>::lanes * threads;
+        best = std::max(best, flops / (ms * 1e6));
+    }
+
+    spdlog::debug("FMA microkernel ({} bytes): {} chains, sink {}", sizeof(T), fma_chains,
+                  static_cast<double>(sinks[0]));
+    return best;
+}
+
+// STREAM triad a = b + s*c over per-thread arrays of `elements` doubles each;
+// counts 24 bytes per element as STREAM does (no write-allocate traffic)
+double measure_triad_gbs(int threads, std::size_t elements, const std::vector<int>& cpus)
+{
+    elements = std::max<std::size_t>(elements, 1024);
+    std::vector<std::vector<double>> a(threads), b(threads), c(threads);
+    // Each thread first-touches its own arrays
+    run_parallel(threads, cpus, [&](int t) {
+        a[t].assign(elements, 0.0);
+        b[t].assign(elements, 1.0);
+        c[t].assign(elements, 2.0);
+    });
+
+    const double pass_bytes = 3.0 * sizeof(double) * static_cast<double>(elements) * threads;
+    std::size_t passes = 1;
+    double best = 0.0;
+
+    for (int trial = 0; trial < trials; ++trial)
+    {
+        double ms = 0.0;
+        do
+        {
+            ms = run_parallel(threads, cpus, [&](int t) {
+                double* pa = a[t].data();
+                const double* pb = b[t].data();
+                const double* pc = c[t].data();
+                for (std::size_t p = 0; p < passes; ++p)
+                {
+                    const double s = 3.0;
+                    for (std::size_t i = 0; i < elements; ++i)
+                    {
+                        pa[i] = pb[i] + s * pc[i];
+                    }
+                    // Keep every pass: the stores must be observable before the next one
+                    asm volatile("" : : "r"(pa) : "memory");
+                }
+            });
+            if (ms < min_measure_ms)
+            {
+                passes *= 2;
+            }
+        } while (ms < min_measure_ms);
+
+        best = std::max(best, pass_bytes * static_cast<double>(passes) / (ms * 1e6));
+    }
+    return best;
+}
+
+} // anonymous namespace
+
+MachinePeaks measure_machine_peaks(const SystemInfo& info, int threads, const std::vector<int>& cpus)
+{
+    MachinePeaks peaks;
+    peaks.threads = std::max(threads, 1);
+    peaks.l2_bytes = info.l2_cache > 0 ? info.l2_cache : 256 * 1024;
+    peaks.l3_bytes = info.l3_cache;
+
+    spdlog::info("Measuring machine peaks with {} thread(s)...", peaks.threads);
+
+    peaks.peak_gflops_double = measure_peak_gflops<double>(peaks.threads, cpus);
+    peaks.peak_gflops_single = measure_peak_gflops<float>(peaks.threads, cpus);
+
+    // Three arrays per thread filling half of the cache level they target
+    constexpr std::size_t arrays = 3;
+    peaks.l2_gbs = measure_triad_gbs(peaks.threads, peaks.l2_bytes / 2 / arrays / sizeof(double), cpus);
+    if (peaks.l3_bytes > 2 * peaks.l2_bytes * peaks.threads)
+    {
+        std::size_t per_thread = peaks.l3_bytes / 2 / static_cast<std::size_t>(peaks.threads);
+        peaks.l3_gbs = measure_triad_gbs(peaks.threads, per_thread / arrays / sizeof(double), cpus);
+    }
+
+    // Far beyond the LLC, but bounded by a quarter of physical memory
+    std::size_t dram_total = std::max<std::size_t>(4 * peaks.l3_bytes, 256 * 1024 * 1024);
+    if (info.total_memory > 0)
+    {
+        dram_total = std::min(dram_total, info.total_memory / 4);
+    }
+    peaks.dram_gbs = measure_triad_gbs(
+        peaks.threads, dram_total / static_cast<std::size_t>(peaks.threads) / arrays / sizeof(double), cpus);
+
+    spdlog::info("Peak FMA: {:.1f} GFLOPS (double), {:.1f} GFLOPS (single)",
+                 peaks.peak_gflops_double, peaks.peak_gflops_single);
+    spdlog::info("Triad bandwidth: L2 {:.1f} GB/s, L3 {:.1f} GB/s, DRAM {:.1f} GB/s",
+                 peaks.l2_gbs, peaks.l3_gbs, peaks.dram_gbs);
+    return peaks;
+}
+
+RooflineBound roofline_bound(const MachinePeaks& peaks, double intensity, std::size_t working_set_bytes,
+                             bool cold_cache, bool single_precision)
+{
+    RooflineBound bound;
+
+    // Smallest cache level (summed over threads for private L2) holding the working set
+    double bandwidth = peaks.dram_gbs;
+    bound.limit = "DRAM";
+    if (!cold_cache)
+    {
+        if (working_set_bytes <= peaks.l2_bytes * static_cast<std::size_t>(peaks.threads))
+        {
+            bandwidth = peaks.l2_gbs;
+            bound.limit = "L2";
+        }
+        else if (peaks.l3_gbs > 0.0 && working_set_bytes <= peaks.l3_bytes)
+        {
+            bandwidth = peaks.l3_gbs;
+            bound.limit = "L3";
+        }
+    }
+
+    double peak = single_precision ? peaks.peak_gflops_single : peaks.peak_gflops_double;
+    double memory_bound = intensity * bandwidth;
+    if (memory_bound < peak)
+    {
+        bound.gflops = memory_bound;
+    }
+    else
+    {
+        bound.gflops = peak;
+        bound.limit = "compute";
+    }
+    return bound;
+}
+
+} // namespace blas_benchmark::utils
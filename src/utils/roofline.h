@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utils/system_info.h"
+
+namespace blas_benchmark::utils
+{
+
+// Measured machine limits for the roofline model, at a given thread count
+struct MachinePeaks
+{
+    int threads{1};
+    double peak_gflops_double{0.0}; // Register-resident FMA microkernel
+    double peak_gflops_single{0.0};
+    double l2_gbs{0.0};   // STREAM triad with per-thread arrays in L2
+    double l3_gbs{0.0};   // ... in a shared slice of L3 (0 without L3)
+    double dram_gbs{0.0}; // ... with arrays far larger than the LLC
+    std::size_t l2_bytes{0};
+    std::size_t l3_bytes{0};
+};
+
+// Which roof bounds a kernel
+struct RooflineBound
+{
+    double gflops{0.0};     // min(peak, intensity * bandwidth)
+    std::string limit;      // "compute", "L2", "L3" or "DRAM"
+};
+
+// Measure FMA peaks and triad bandwidth for L2, L3 and DRAM using `threads` threads,
+// thread i pinned to cpus[i % cpus.size()] unless `cpus` is empty
+// Takes a few seconds; peaks depend on the build flags (-march=native for full SIMD width)
+[[nodiscard]] MachinePeaks measure_machine_peaks(const SystemInfo& info, int threads,
+                                                 const std::vector<int>& cpus = {});
+
+// Attainable GFLOPS for a kernel with the given arithmetic intensity (FLOPs/byte)
+// The bandwidth roof is picked from the working set size; cold-cache runs always use DRAM
+[[nodiscard]] RooflineBound roofline_bound(const MachinePeaks& peaks, double intensity,
+                                           std::size_t working_set_bytes, bool cold_cache,
+                                           bool single_precision);
+
+} // namespace blas_benchmark::utils
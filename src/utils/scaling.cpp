@@ -0,0 +1,86 @@
+#include "utils/scaling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace blas_benchmark::utils
+{
+
+ScalingMode parse_scaling_mode(const std::string& name)
+{
+    if (name == "strong")
+    {
+        return ScalingMode::strong;
+    }
+    if (name == "weak")
+    {
+        return ScalingMode::weak;
+    }
+    if (name == "both")
+    {
+        return ScalingMode::both;
+    }
+    throw std::invalid_argument("Unknown scaling mode: " + name + " (expected strong, weak or both)");
+}
+
+std::string to_string(ScalingMode mode)
+{
+    switch (mode)
+    {
+    case ScalingMode::weak:
+        return "weak";
+    case ScalingMode::both:
+        return "both";
+    case ScalingMode::strong:
+    default:
+        return "strong";
+    }
+}
+
+std::size_t weak_dimension(std::size_t dim, int rank, double factor)
+{
+    double scaled = static_cast<double>(dim) * std::pow(factor, 1.0 / std::max(rank, 1));
+    return std::max<std::size_t>(static_cast<std::size_t>(std::llround(scaled)), 1);
+}
+
+std::vector<ScalingPoint> scaling_curve(std::vector<std::pair<int, double>> times_ms)
+{
+    std::sort(times_ms.begin(), times_ms.end());
+
+    std::vector<ScalingPoint> curve;
+    curve.reserve(times_ms.size());
+    for (const auto& [threads, time] : times_ms)
+    {
+        ScalingPoint point;
+        point.threads = threads;
+        point.time_ms = time;
+        if (!curve.empty() && time > 0.0)
+        {
+            const auto& base = curve.front();
+            const auto& previous = curve.back();
+            point.speedup = base.time_ms / time;
+            point.efficiency = point.speedup * base.threads / threads;
+
+            // A step that adds no threads (or no speedup baseline) has no marginal gain to measure
+            double thread_gain = static_cast<double>(threads) / previous.threads - 1.0;
+            point.marginal = thread_gain > 0.0 ? (point.speedup / previous.speedup - 1.0) / thread_gain : 0.0;
+        }
+        curve.push_back(point);
+    }
+    return curve;
+}
+
+std::size_t knee_index(const std::vector<ScalingPoint>& curve, double threshold)
+{
+    for (std::size_t i = 1; i < curve.size(); ++i)
+    {
+        if (curve[i].marginal < threshold)
+        {
+            return i - 1;
+        }
+    }
+    return curve.empty() ? 0 : curve.size() - 1;
+}
+
+} // namespace blas_benchmark::utils
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+// Which scaling experiment a thread sweep runs
+enum class ScalingMode
+{
+    strong, // Fixed problem size, more threads
+    weak,   // Problem size grows with the thread count so the work per thread stays constant
+    both    // Both series at every thread count
+};
+
+// Parse "strong", "weak" or "both"; throws std::invalid_argument otherwise
+[[nodiscard]] ScalingMode parse_scaling_mode(const std::string& name);
+
+[[nodiscard]] std::string to_string(ScalingMode mode);
+
+// Weak scaling: `dim` grown so a problem with `rank` dimensions of this size does
+// `factor` times the work, i.e. dim * factor^(1/rank), at least 1
+[[nodiscard]] std::size_t weak_dimension(std::size_t dim, int rank, double factor);
+
+// One thread count of a scaling curve
+struct ScalingPoint
+{
+    int threads{1};
+    double time_ms{0.0};
+    double speedup{1.0};    // Time at the smallest thread count / time here
+    double efficiency{1.0}; // speedup / (threads / smallest thread count)
+    double marginal{1.0};   // Speedup gained by this step relative to its thread increase (1 = linear)
+};
+
+// Speedup and parallel efficiency of one kernel from (threads, time ms) pairs;
+// the result is sorted by thread count. For weak scaling pass the time per unit of
+// the smallest count's work, so speedup is the scaled speedup (ideal: thread ratio)
+[[nodiscard]] std::vector<ScalingPoint> scaling_curve(std::vector<std::pair<int, double>> times_ms);
+
+// Knee of a scaling curve: the last thread count before the first step whose
+// marginal efficiency falls below `threshold` (the largest count if none does)
+[[nodiscard]] std::size_t knee_index(const std::vector<ScalingPoint>& curve, double threshold = 0.5);
+
+} // namespace blas_benchmark::utils
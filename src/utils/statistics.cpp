@@ -0,0 +1,125 @@
+#include "utils/statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "utils/random.h"
+
+namespace blas_benchmark::utils
+{
+
+double percentile(const std::vector<double>& sorted, double pct)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+
+    double rank = std::clamp(pct, 0.0, 100.0) / 100.0 * static_cast<double>(sorted.size() - 1);
+    auto lower = static_cast<std::size_t>(std::floor(rank));
+    auto upper = static_cast<std::size_t>(std::ceil(rank));
+    double fraction = rank - static_cast<double>(lower);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * fraction;
+}
+
+double mean(const std::vector<double>& samples)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+    return std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+}
+
+double median(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    return percentile(samples, 50.0);
+}
+
+SampleStats compute_stats(const std::vector<double>& samples)
+{
+    SampleStats stats;
+    stats.count = samples.size();
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    stats.min = sorted.front();
+    stats.max = sorted.back();
+    stats.mean = mean(sorted);
+    stats.median = percentile(sorted, 50.0);
+    stats.p5 = percentile(sorted, 5.0);
+    stats.p95 = percentile(sorted, 95.0);
+    stats.p99 = percentile(sorted, 99.0);
+
+    if (sorted.size() > 1)
+    {
+        double sum_sq = 0.0;
+        for (double value : sorted)
+        {
+            sum_sq += (value - stats.mean) * (value - stats.mean);
+        }
+        stats.stddev = std::sqrt(sum_sq / static_cast<double>(sorted.size() - 1));
+    }
+    stats.cv = stats.mean > 0.0 ? stats.stddev / stats.mean : 0.0;
+
+    std::vector<double> deviations;
+    deviations.reserve(sorted.size());
+    for (double value : sorted)
+    {
+        deviations.push_back(std::abs(value - stats.median));
+    }
+    stats.mad = median(std::move(deviations));
+
+    return stats;
+}
+
+ConfidenceInterval bootstrap_ci(const std::vector<double>& samples,
+                                const SampleStatistic& statistic,
+                                double confidence,
+                                std::size_t resamples,
+                                std::uint64_t seed)
+{
+    ConfidenceInterval ci;
+    if (samples.empty())
+    {
+        return ci;
+    }
+    if (samples.size() == 1 || resamples == 0)
+    {
+        ci.lower = ci.upper = statistic(samples);
+        return ci;
+    }
+
+    const CounterRng rng(seed);
+    const std::size_t n = samples.size();
+    std::uint64_t counter = 0;
+
+    std::vector<double> estimates;
+    estimates.reserve(resamples);
+    std::vector<double> resample(n);
+
+    for (std::size_t r = 0; r < resamples; ++r)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // Modulo bias is negligible for sample counts far below 2^64
+            resample[i] = samples[rng(counter++) % n];
+        }
+        estimates.push_back(statistic(resample));
+    }
+
+    std::sort(estimates.begin(), estimates.end());
+    double tail = (1.0 - confidence) / 2.0 * 100.0;
+    ci.lower = percentile(estimates, tail);
+    ci.upper = percentile(estimates, 100.0 - tail);
+    return ci;
+}
+
+} // namespace blas_benchmark::utils
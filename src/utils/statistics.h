@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace blas_benchmark::utils
+{
+
+// Summary statistics of a set of timing samples
+struct SampleStats
+{
+    std::size_t count{0};
+    double min{0.0};
+    double max{0.0};
+    double mean{0.0};
+    double median{0.0};
+    double stddev{0.0}; // Sample standard deviation (n - 1)
+    double mad{0.0};    // Median absolute deviation (unscaled)
+    double p5{0.0};
+    double p95{0.0};
+    double p99{0.0};
+    double cv{0.0};     // Coefficient of variation: stddev / mean
+};
+
+// Two-sided confidence interval
+struct ConfidenceInterval
+{
+    double lower{0.0};
+    double upper{0.0};
+};
+
+// Statistic evaluated on a (re)sample, e.g. mean or median
+using SampleStatistic = std::function<double(const std::vector<double>&)>;
+
+// Compute summary statistics; an empty input gives all zeros
+[[nodiscard]] SampleStats compute_stats(const std::vector<double>& samples);
+
+// Percentile (0-100) of sorted samples with linear interpolation
+[[nodiscard]] double percentile(const std::vector<double>& sorted, double pct);
+
+[[nodiscard]] double mean(const std::vector<double>& samples);
+
+[[nodiscard]] double median(std::vector<double> samples);
+
+// Percentile bootstrap confidence interval of a statistic
+// Resampling uses a fixed-seed counter-based generator, so the interval is reproducible
+[[nodiscard]] ConfidenceInterval bootstrap_ci(const std::vector<double>& samples,
+                                              const SampleStatistic& statistic,
+                                              double confidence = 0.95,
+                                              std::size_t resamples = 1000,
+                                              std::uint64_t seed = 0);
+
+} // namespace blas_benchmark::utils
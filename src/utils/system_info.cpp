@@ -4,6 +4,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 
 #ifdef __linux__
 #include <sys/sysinfo.h>
@@ -80,6 +81,45 @@ std::unordered_map<std::string, std::string> parse_cpuinfo()
 
 } // anonymous namespace
 
+std::vector<int> parse_cpu_list(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::stringstream stream(trim(list));
+    std::string range;
+
+    while (std::getline(stream, range, ','))
+    {
+        range = trim(range);
+        if (range.empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            auto dash = range.find('-');
+            if (dash == std::string::npos)
+            {
+                cpus.push_back(std::stoi(range));
+            }
+            else
+            {
+                int first = std::stoi(range.substr(0, dash));
+                int last = std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu)
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+
+    return cpus;
+}
+
 SystemInfo SystemInfoCollector::collect() const
 {
     SystemInfo info;
@@ -327,6 +367,35 @@ std::size_t SystemInfoCollector::get_total_memory() const
     return 16ULL * 1024 * 1024 * 1024;
 }
 
+std::vector<NumaNode> SystemInfoCollector::get_numa_nodes() const
+{
+    std::vector<NumaNode> nodes;
+#ifdef __linux__
+    auto online = parse_cpu_list(read_file("/sys/devices/system/node/online"));
+    for (int id : online)
+    {
+        NumaNode node;
+        node.id = id;
+        node.cpus = parse_cpu_list(read_file("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist"));
+        if (!node.cpus.empty())
+        {
+            nodes.push_back(std::move(node));
+        }
+    }
+#endif
+    if (nodes.empty())
+    {
+        // Fallback: one node holding every logical CPU
+        NumaNode node;
+        for (int cpu = 0; cpu < get_cpu_cores(); ++cpu)
+        {
+            node.cpus.push_back(cpu);
+        }
+        nodes.push_back(std::move(node));
+    }
+    return nodes;
+}
+
 std::string SystemInfoCollector::get_os_name() const
 {
 #ifdef __linux__
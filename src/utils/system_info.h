@@ -23,6 +23,16 @@ struct SystemInfo
     std::string os_name;
 };
 
+// NUMA node and the logical CPUs that belong to it
+struct NumaNode
+{
+    int id{0};
+    std::vector<int> cpus;
+};
+
+// Parse a Linux CPU list string such as "0-3,8,10-11"
+[[nodiscard]] std::vector<int> parse_cpu_list(const std::string& list);
+
 // Collect system information for benchmark context
 class SystemInfoCollector
 {
@@ -62,6 +72,9 @@ public:
     // Get operating system name
     [[nodiscard]] std::string get_os_name() const;
 
+    // Get online NUMA nodes with their CPUs (a single node 0 if unknown)
+    [[nodiscard]] std::vector<NumaNode> get_numa_nodes() const;
+
     // Get total cache size (L1 + L2 + L3) for cache flush
     [[nodiscard]] std::size_t get_total_cache() const
     {
@@ -1,4 +1,104 @@
 #include "utils/timer.h"
 
-// This file is intentionally minimal as Timer is header-only with inline functions
-// Future implementation details can be added here if needed
+#include <stdexcept>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace blas_benchmark::utils
+{
+
+bool CycleTimer::supported()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool invariant_tsc = []() {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007)
+        {
+            return false;
+        }
+        __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+        return (edx & (1U << 8)) != 0;
+    }();
+    return invariant_tsc;
+#else
+    return false;
+#endif
+}
+
+double CycleTimer::tsc_hz()
+{
+    static const double hz = []() {
+        if (!supported())
+        {
+            return 1e9; // steady_clock fallback counts nanoseconds
+        }
+
+        // Best of a few short windows, so a preemption in one window does not skew the result
+        double best = 0.0;
+        double best_error = std::numeric_limits<double>::max();
+        for (int attempt = 0; attempt < 5; ++attempt)
+        {
+            auto t0 = std::chrono::steady_clock::now();
+            std::uint64_t c0 = read_start();
+            auto t0_after = std::chrono::steady_clock::now();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+            auto t1 = std::chrono::steady_clock::now();
+            std::uint64_t c1 = read_stop();
+            auto t1_after = std::chrono::steady_clock::now();
+
+            // The uncertainty of each clock read is the time spent taking it
+            double error = std::chrono::duration<double>((t0_after - t0) + (t1_after - t1)).count();
+            double elapsed = std::chrono::duration<double>(t1 - t0).count();
+            if (elapsed > 0.0 && error < best_error)
+            {
+                best_error = error;
+                best = static_cast<double>(c1 - c0) / elapsed;
+            }
+        }
+        return best > 0.0 ? best : 1e9;
+    }();
+    return hz;
+}
+
+TimerSource parse_timer_source(const std::string& name)
+{
+    if (name == "chrono")
+    {
+        return TimerSource::chrono;
+    }
+    if (name == "tsc")
+    {
+        if (!CycleTimer::supported())
+        {
+            throw std::invalid_argument("timer = \"tsc\" requires an invariant TSC");
+        }
+        return TimerSource::tsc;
+    }
+    if (name == "auto")
+    {
+        return CycleTimer::supported() ? TimerSource::tsc : TimerSource::chrono;
+    }
+    throw std::invalid_argument("Unknown timer: " + name + " (expected chrono, tsc or auto)");
+}
+
+std::string to_string(TimerSource source)
+{
+    switch (source)
+    {
+    case TimerSource::chrono:
+        return "chrono";
+    case TimerSource::tsc:
+        return "tsc";
+    }
+    return "unknown";
+}
+
+} // namespace blas_benchmark::utils
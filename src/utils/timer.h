@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <limits>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 namespace blas_benchmark::utils
 {
@@ -26,11 +32,10 @@ public:
         m_end = std::chrono::high_resolution_clock::now();
     }
 
-    // Get elapsed time in milliseconds
+    // Get elapsed time in milliseconds (nanosecond resolution, not truncated)
     [[nodiscard]] double elapsed_ms() const
     {
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(m_end - m_start);
-        return static_cast<double>(duration.count()) / 1000.0;
+        return elapsed_ns() / 1000000.0;
     }
 
     // Get elapsed time in nanoseconds
@@ -43,8 +48,7 @@ public:
     // Get elapsed time in seconds
     [[nodiscard]] double elapsed_sec() const
     {
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(m_end - m_start);
-        return static_cast<double>(duration.count()) / 1000000.0;
+        return elapsed_ns() / 1000000000.0;
     }
 
 private:
@@ -52,26 +56,115 @@ private:
     std::chrono::high_resolution_clock::time_point m_end;
 };
 
-// Flush CPU cache by accessing a buffer larger than cache size
-// This ensures cold cache conditions for accurate benchmarking
-inline void flush_cache(std::size_t cache_size_bytes)
+// Low-overhead timer reading the time stamp counter
+// start() is fenced so earlier work cannot leak into the region; stop() uses
+// rdtscp (waits for the timed work) followed by lfence (keeps later work out).
+// Counts reference cycles at the invariant TSC rate, not core clock cycles.
+// Falls back to steady_clock (1 "cycle" = 1 ns) where no invariant TSC exists.
+class CycleTimer
 {
-    // Allocate buffer 4x larger than cache to ensure complete eviction
-    constexpr std::size_t multiplier = 4;
-    std::size_t buffer_size = cache_size_bytes * multiplier / sizeof(double);
-    
-    auto buffer = std::vector<double>(buffer_size, 0.0);
-    
-    // Read and write to each element to evict cache lines
-    volatile double sum = 0.0;
-    for (std::size_t i = 0; i < buffer_size; ++i)
+public:
+    CycleTimer() = default;
+
+    // True if the CPU reports an invariant TSC (CPUID.80000007H:EDX[8])
+    [[nodiscard]] static bool supported();
+
+    // TSC frequency in Hz, calibrated against steady_clock on first use
+    [[nodiscard]] static double tsc_hz();
+
+    void start()
+    {
+        m_start = read_start();
+    }
+
+    void stop()
+    {
+        m_end = read_stop();
+    }
+
+    // Reference cycles between start() and stop()
+    [[nodiscard]] std::uint64_t elapsed_cycles() const
+    {
+        return m_end - m_start;
+    }
+
+    [[nodiscard]] double elapsed_ns() const
     {
-        sum += buffer[i];
-        buffer[i] = static_cast<double>(i);
+        return static_cast<double>(elapsed_cycles()) / tsc_hz() * 1e9;
     }
-    
-    // Prevent compiler optimization
-    (void)sum;
+
+    [[nodiscard]] double elapsed_ms() const
+    {
+        return elapsed_ns() / 1000000.0;
+    }
+
+    // Raw counter reads, exposed for calibration
+    static std::uint64_t read_start()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        if (supported())
+        {
+            _mm_lfence();
+            std::uint64_t tsc = __rdtsc();
+            _mm_lfence();
+            return tsc;
+        }
+#endif
+        return steady_ns();
+    }
+
+    static std::uint64_t read_stop()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        if (supported())
+        {
+            unsigned int aux = 0;
+            std::uint64_t tsc = __rdtscp(&aux);
+            _mm_lfence();
+            return tsc;
+        }
+#endif
+        return steady_ns();
+    }
+
+private:
+    static std::uint64_t steady_ns()
+    {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    std::uint64_t m_start{0};
+    std::uint64_t m_end{0};
+};
+
+// Which timer the fixtures use for timed samples
+enum class TimerSource
+{
+    chrono, // std::chrono::high_resolution_clock
+    tsc     // CycleTimer
+};
+
+// Parse "chrono", "tsc" or "auto" (tsc when an invariant TSC is available)
+[[nodiscard]] TimerSource parse_timer_source(const std::string& name);
+[[nodiscard]] std::string to_string(TimerSource source);
+
+// Measure the cost of an empty start()/stop() pair in nanoseconds
+// Returns the minimum over many trials, which is what a timed region always pays
+template<typename TimerT = Timer>
+[[nodiscard]] double measure_timer_overhead_ns(std::size_t trials = 10000)
+{
+    double overhead = std::numeric_limits<double>::max();
+    TimerT timer;
+
+    for (std::size_t i = 0; i < trials; ++i)
+    {
+        timer.start();
+        timer.stop();
+        overhead = std::min(overhead, timer.elapsed_ns());
+    }
+
+    return trials > 0 ? overhead : 0.0;
 }
 
 // Get estimated cache size for flush operation